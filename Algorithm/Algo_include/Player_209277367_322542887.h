@@ -3,6 +3,7 @@
 #include "../common/Player.h"
 #include "../common/SatelliteView.h"
 #include "../UserCommon/UC_include/ExtBattleInfo.h"
+#include "../UserCommon/UC_include/Resettable.h"
 #include <vector>
 #include <utility>
 #include <memory>
@@ -17,7 +18,8 @@ namespace Algorithm_209277367_322542887 {
         bool alive;
     };
 
-    class Player_209277367_322542887 : public Player{
+    // Resettable, so the Simulator may reuse one instance for many games
+    class Player_209277367_322542887 : public Player, public UserCommon_209277367_322542887::ResettablePlayer {
     public:
         // Rule of 5
         Player_209277367_322542887(int player_index, int x, int y, size_t max_steps, size_t num_shells); // Constructor
@@ -26,6 +28,8 @@ namespace Algorithm_209277367_322542887 {
         Player_209277367_322542887& operator=(Player_209277367_322542887&&) noexcept = delete; // Move assignment operator deleted
         ~Player_209277367_322542887() override = default; // Destructor
 
+        void reset(int player_index, size_t x, size_t y, size_t max_steps, size_t num_shells) override; // Start over as a new player
+
     protected:
         // Function to initiate gameboard, shells locations and tank locations based on satellite view
         void initGameboardAndShells(vector<vector<char>>& gameboard, vector<pair<int,int>>& shells_location, SatelliteView &satellite_view,
@@ -4,6 +4,8 @@
 #include "../common/ActionRequest.h"
 #include "../common/BattleInfo.h"
 #include "../../UserCommon/UC_include/Direction.h"
+#include "../../UserCommon/UC_include/ThreadSafeTankAlgorithm.h"
+#include "../../UserCommon/UC_include/Resettable.h"
 #include <utility>
 #include <queue>
 #include <stack>
@@ -19,7 +21,9 @@ using namespace UserCommon_209277367_322542887;
 static constexpr int INF = std::numeric_limits<int>::max(); // infinity
 
 namespace Algorithm_209277367_322542887 {
-    class TankAlgorithm_209277367_322542887 : public TankAlgorithm {
+    // Instances share no mutable state, so the GameManager may collect their actions in parallel,
+    // and they can be reset, so the Simulator may reuse them across games
+    class TankAlgorithm_209277367_322542887 : public TankAlgorithm, public ThreadSafeTankAlgorithm, public ResettableTankAlgorithm {
     protected:
         pair<int, int> location_;
         Direction direction_;
@@ -63,6 +67,8 @@ namespace Algorithm_209277367_322542887 {
         TankAlgorithm_209277367_322542887& operator=(TankAlgorithm_209277367_322542887&&) noexcept = delete; // Move assignment
         ~TankAlgorithm_209277367_322542887() override = default; // Virtual destructor
 
+        void reset(int player_index, int tank_index) override; // Start over as a new tank
+
 
         //Should both tanks have the same logic?
         void updateBattleInfo(BattleInfo& info) override; // Placeholder for the updateBattleInfo method
@@ -1,6 +1,8 @@
 #include "Player_209277367_322542887.h"
 #include "../common/PlayerRegistration.h"
 #include "TankAlgorithm_209277367_322542887.h"
+#include "ViewAccess.h"
+#include <cstring>
 
 using namespace Algorithm_209277367_322542887;
 REGISTER_PLAYER(Player_209277367_322542887);
@@ -10,6 +12,12 @@ Player_209277367_322542887::Player_209277367_322542887(const int player_index, c
     : playerIndex_(player_index), x_(x), y_(y), maxSteps_(max_steps), numShells_(num_shells) {
 }
 
+// Start over as a new player with the factory's arguments
+void Player_209277367_322542887::reset(const int player_index, const size_t x, const size_t y, const size_t max_steps, const size_t num_shells) {
+    playerIndex_ = player_index, x_ = static_cast<int>(x), y_ = static_cast<int>(y), maxSteps_ = max_steps, numShells_ = num_shells;
+    tankStatus_.clear();
+}
+
 // Function to update tank with battle info
 void Player_209277367_322542887::updateTankWithBattleInfo(TankAlgorithm& tank, SatelliteView& satellite_view) {
     vector<vector<char>> gameboard;
@@ -19,18 +27,17 @@ void Player_209277367_322542887::updateTankWithBattleInfo(TankAlgorithm& tank, S
     // Initialize the gameboard with satellite_view and gather shell locations
     initGameboardAndShells(gameboard, shells_location, satellite_view, tank_location);
 
-    // Create a new battle info object
-    const unique_ptr<BattleInfo> battleInfo = make_unique<ExtBattleInfo>(gameboard, shells_location, numShells_, tank_location);
+    // Create the battle info, handing it the board and shells
+    ExtBattleInfo battleInfo(std::move(gameboard), std::move(shells_location), static_cast<int>(numShells_), tank_location);
 
     // Update tank with battle info -
     // If it's the first time the tank receives battle info, initialize the tank's ammo and location
     // otherwise, update the tank's gameboard and shell locations
     // and update the battle info with the current tank's information
-    tank.updateBattleInfo(*battleInfo);
+    tank.updateBattleInfo(battleInfo);
 
     // Receive updates from tank
-    const int tank_index = dynamic_cast<ExtBattleInfo*>(battleInfo.get())->getTankIndex();
-    tankStatus_[tank_index].ammo = dynamic_cast<ExtBattleInfo&>(*battleInfo).getCurrAmmo();
+    tankStatus_[battleInfo.getTankIndex()].ammo = battleInfo.getCurrAmmo();
 }
 
 
@@ -40,20 +47,16 @@ void Player_209277367_322542887::initGameboardAndShells(vector<vector<char>>& ga
 
     gameboard.resize(y_, vector<char>(x_, ' ')); // Resize the gameboard to match satellite_view
 
-    // Iterate over the satellite_view and update the gameboard
+    // Copy the satellite_view row by row (memcpy for our own views), then scan each row for shells and self
+    const size_t width = static_cast<size_t>(x_);
     for (int i = 0; i < y_; ++i){
-        for (int j = 0; j < x_; ++j){
-            const char obj = satellite_view.getObjectAt(j, i);
-            gameboard[i][j] = obj; // Update the gameboard with the object from satellite_view
-
-            if (obj == '*') { // Found shell
-                shells_location.emplace_back(j, i);
-            }
+        char* row = gameboard[i].data();
+        copyViewRow(satellite_view, static_cast<size_t>(i), width, row);
 
-            else if (obj == '%') { // Found self
-                tank_location = {j, i};
+        findInRow(row, width, static_cast<size_t>(i), '*', shells_location); // Found shells
 
-            }
+        if (const void* self = memchr(row, '%', width)) { // Found self
+            tank_location = {static_cast<int>(static_cast<const char*>(self) - row), i};
         }
     }
 }
@@ -10,7 +10,7 @@ REGISTER_TANK_ALGORITHM(TankAlgorithm_209277367_322542887);
 // Constructor
 TankAlgorithm_209277367_322542887::TankAlgorithm_209277367_322542887(int player_index, int tank_index) :location_(-1, -1), playerIndex_(player_index), tankIndex_(tank_index),
 ammo_(0), alive_(true), turnsToShoot_(0), turnsToEvade_(0), backwardsFlag_(false),justMovedBackwardsFlag_(false), backwardsTimer_(0),
-justGotBattleinfo_(false), firstBattleinfo_(true){
+justGotBattleinfo_(false), firstBattleinfo_(true), shotDir_(Direction::U){
     if (player_index == 1) {
         direction_ = Direction::L;
     } else {
@@ -18,6 +18,20 @@ justGotBattleinfo_(false), firstBattleinfo_(true){
     }
 };
 
+// Start over as a new tank with the factory's arguments, in the state the constructor leaves it in
+void TankAlgorithm_209277367_322542887::reset(const int player_index, const int tank_index) {
+    location_ = {-1, -1};
+    direction_ = (player_index == 1) ? Direction::L : Direction::R;
+    actionsQueue_ = {};
+    playerIndex_ = player_index, tankIndex_ = tank_index;
+    ammo_ = 0, alive_ = true, turnsToShoot_ = 0, turnsToEvade_ = 0;
+    backwardsFlag_ = false, justMovedBackwardsFlag_ = false, backwardsTimer_ = 0;
+    justGotBattleinfo_ = false, firstBattleinfo_ = true;
+    shotDir_ = Direction::U, shotDirCooldown_ = 0;
+    gameboard.clear();
+    shellLocations_.clear();
+}
+
 // Calculate the direction based on the difference in x and y
 Direction TankAlgorithm_209277367_322542887 :: diffToDir(const int diff_x, const int diff_y, const int rows, const int cols){
     int pass = 0;
@@ -305,7 +319,7 @@ void TankAlgorithm_209277367_322542887 :: decreaseShotDirCooldown() { if (shotDi
 
 // Function to update the tank with battleinfo from player
 void TankAlgorithm_209277367_322542887 :: updateBattleInfo(BattleInfo& info){
-    auto battle_info = dynamic_cast<ExtBattleInfo&>(info); // Cast the battleinfo to ExtBattleInfo
+    auto& battle_info = dynamic_cast<ExtBattleInfo&>(info); // Cast the battleinfo to ExtBattleInfo
 
     // If it's the first time the tank receives battleinfo - initialize the tank's ammo and location
     if (firstBattleinfo_) {
@@ -315,8 +329,8 @@ void TankAlgorithm_209277367_322542887 :: updateBattleInfo(BattleInfo& info){
     }
 
     // Update the battle information of the tank
-    this->gameboard = battle_info.getGameboard(); // Get the gameboard from the battle info
-    this->shellLocations_ = battle_info.getShellsLocation(); // Get the shells locations from the battle info
+    this->gameboard = battle_info.takeGameboard(); // Take the gameboard from the battle info
+    this->shellLocations_ = battle_info.takeShellsLocation(); // Take the shells locations from the battle info
 
     // Update battle info with the current tank's information
     battle_info.setTankIndex(tankIndex_); // Set the current tank index
@@ -8,29 +8,55 @@
 #include <map>
 #include <mutex>
 #include <filesystem>
+#include <algorithm>
+#include <unordered_map>
 
 #include "AbstractGameManager.h"
+#include "../UserCommon/UC_include/ExtGameManager.h"
 #include "../../common/GameResult.h"
 #include "../../common/TankAlgorithm.h" // FIX
 #include "../common/SatelliteView.h"
 #include "../common/Player.h"
-#include "TankInfo.h"
-#include "../UserCommon/UC_include/Shell.h"
+#include "TankRegistry.h"
+#include "ShellPool.h"
+#include "GameLogWriter.h"
+#include "Replay.h"
+#include "GameSnapshot.h"
+#include "Zobrist.h"
+#include "GameStats.h"
+#include "TimeBudget.h"
+#include "WorkerPool.h"
+#include "GameArena.h"
 #include "../common/ActionRequest.h"
 #include "../../common/SatelliteView.h"
 #include "../../common/ActionRequest.h"
 #include "../UserCommon/UC_include/ExtSatelliteView.h"
+#include "../UserCommon/UC_include/SharedSatelliteView.h"
+#include "../UserCommon/UC_include/ViewAccess.h"
+#include "../UserCommon/UC_include/ThreadSafeTankAlgorithm.h"
+#include "../UserCommon/UC_include/StatelessTankAlgorithm.h"
 
 using std::unique_ptr, std::string, std::vector, std::ifstream, std::ofstream, std::set, std::cout, std::endl, std::move;
-using TankIterator = std::vector<std::unique_ptr<TankInfo>>::iterator;
-using ShellIterator = std::vector<std::unique_ptr<Shell>>::iterator;
 using namespace UserCommon_209277367_322542887;
 namespace fs = std::filesystem;
 
 namespace GameManager_209277367_322542887 {
-    class GM_209277367_322542887 : public AbstractGameManager {
+    // Logging policies for the game loop, chosen once per game in run()
+    struct QuietLog { static constexpr bool enabled = false; }; // All log output compiled out
+    struct VerboseLog { static constexpr bool enabled = true; }; // Write the per-turn game log
+
+    // Instrumentation policies for the game loop, chosen once per game in run()
+    struct NoStats { static constexpr bool enabled = false; }; // No clock reads in the loop
+    struct CollectStats { static constexpr bool enabled = true; }; // Time every phase and count per turn
+
+    class GM_209277367_322542887 : public ExtGameManager {
 
     public:
+        static constexpr size_t kNeighborTableMaxCells = size_t{1} << 20; // Larger boards compute neighbors on the fly
+        static constexpr size_t kMaxReservedShells = size_t{1} << 16; // Shell slots reserved up front at most
+        static constexpr int kMinBandRows = 64; // Automatic shell bands are at least this many rows high
+        static constexpr size_t kMinBandedShells = 4096; // With automatic bands, fewer shells use the event engine alone
+
         explicit GM_209277367_322542887(bool verbose); // Constructor
         GM_209277367_322542887& operator=(const GM_209277367_322542887&) = delete; // Copy assignment
         GM_209277367_322542887(GM_209277367_322542887&&) noexcept = delete; // Move constructor
@@ -41,20 +67,44 @@ namespace GameManager_209277367_322542887 {
             size_t max_steps, size_t num_shells, Player& player1, string name1, Player& player2, string name2,
             TankAlgorithmFactory player1_tank_algo_factory, TankAlgorithmFactory player2_tank_algo_factory) override;
         pair<int, int> getGameboardSize() const;
+        void setOptions(const GameManagerOptions& options) override;
+        BudgetReport getBudgetReport() const override { return budgetReport_; }
+
+        // Steppable game (run() is these four in a row)
+        bool init(size_t map_width, size_t map_height, const SatelliteView& map, string map_name,
+            size_t max_steps, size_t num_shells, Player& player1, string name1, Player& player2, string name2,
+            TankAlgorithmFactory player1_tank_algo_factory, TankAlgorithmFactory player2_tank_algo_factory) override;
+        bool step(size_t turns) override;
+        bool finished() const override { return gameOver_; }
+        GameResult result() override; // Moves the final board out; call once the game is finished
+        vector<unique_ptr<TankAlgorithm>> releaseTankAlgorithms(int player) override; // Hand back a finished game's algorithms
 
         void setVisualMode(bool visual_mode); // Visualisation
 
+        // Replays, snapshots and what-if runs
+        bool replayTo(const ReplayReader& replay, size_t turn); // Rebuild the state at the start of a recorded turn
+        void snapshot(GameSnapshot& out) const; // Save the state between two turns
+        void restore(const GameSnapshot& in); // Continue from a saved state, without players
+        bool stepWithActions(const vector<ActionRequest>& actions); // Play one turn with the given actions
+        uint64_t getStateHash() const; // Zobrist hash of the state between two turns (turn number excluded)
+        const GameStats& getStats() const { return stats_; } // Timings and counters of the last game (needs a stats folder)
+        bool isGameOver() const;
+        int getTurn() const { return turn_; }
+        void printBoard() const;
+
     private:
+        GameArena::Lease arena_; // This thread's arena; per-game containers below allocate from it
         function<std::unique_ptr<TankAlgorithm>(int, int)> player1TankFactory_; // Factory for creating tank algorithms
         function<std::unique_ptr<TankAlgorithm>(int, int)> player2TankFactory_;
         Player* player1_; // Player 1
         Player* player2_; // Player 2
-        vector<vector<char>> gameboard_; // Game board represented as a 2D vector
-        vector<unique_ptr<TankInfo>> tanks_;
-        set<size_t> destroyedTanksIndices_; // Set of tank indices to delete
-        vector<unique_ptr<Shell>> shells_; // Shells fired by tanks
-        ofstream gameLog_; // Log file for game events
+        vector<char> gameboard_; // Game board stored row-major (cell = y * width + x), on the heap: result() hands it over
+        ArenaVector<int> neighbors_{arena_.resource()}; // Toroidal neighbor table, 8 entries per cell indexed by Direction (empty on huge boards)
+        TankRegistry tanks_{arena_.resource()}; // All tanks, their position grid and per-player counters
+        ShellPool shells_{arena_.resource()}; // Shells fired by tanks
+        GameLogWriter gameLog_; // Buffered log file for game events
         GameResult gameResult_;
+        bool hasResult_ = false; // gameResult_ was decided; result() still has to attach the final board
         int numShells_{}; // Number of shells for each tank
         int maxSteps_{}; // Maximum steps for the game
         bool gameOver_{}; // Flag to indicate if the game is over
@@ -67,47 +117,129 @@ namespace GameManager_209277367_322542887 {
         size_t numTanks1_ = 0;
         size_t numTanks2_ = 0;
         bool verbose_ = false;
-        vector<vector<char>> lastRoundGameboard_;
-        vector<pair<ActionRequest, bool>> tankActions_;
+        ArenaVector<char> lastRoundGameboard_{arena_.resource()}; // Start-of-turn board, rebuilt lazily by syncLastRoundGameboard()
+        ArenaVector<pair<int, char>> undoLog_{arena_.resource()}; // (cell, previous value) for every board write this turn
+        ArenaVector<uint8_t> staleCell_{arena_.resource()}; // 1 if lastRoundGameboard_ may differ from gameboard_ at this cell
+        ArenaVector<int> staleCells_{arena_.resource()}; // Cells flagged in staleCell_
+        bool lastRoundSynced_ = false; // lastRoundGameboard_ is current for this turn
+        uint64_t boardHash_ = 0; // Zobrist hash of gameboard_, kept up to date by setBoardCell()
+        ArenaMap<uint64_t, int> seenStates_{arena_.resource()}; // State hash -> turn it was seen at (cycle detection)
+        bool skipCycles_ = false; // Cycle detection is on and every tank's algorithm is a StatelessTankAlgorithm
+        int cycleCheckTurn_ = -1; // Turn whose state is compared with cycleStart_ before skipping, -1 if none
+        int cyclePeriod_ = 0; // Period suggested by the repeated hash
+        GameSnapshot cycleStart_; // State when a hash repeated
+        GameSnapshot cycleEnd_; // State one period later
+        ArenaVector<pair<ActionRequest, bool>> tankActions_{arena_.resource()};
+        GameManagerOptions options_; // Engine options set by the Simulator
+        GameStats stats_; // Per-phase timings and counters of the current game
+        bool statsEnabled_ = false; // stats_ is being collected for this game
+        string mapName_, name1_, name2_; // Names of the current game, for the files written when it ends
+        TimeBudget budget_; // Time limits on the players' algorithm calls
+        BudgetReport budgetReport_; // Overruns and forfeits of the current game
+        bool parallelActions_ = false; // Collect actions on WorkerPool::shared() this game
+        ArenaVector<size_t> liveTanks_{arena_.resource()}; // Alive tanks of the current turn, in index order (parallel collection)
+        ArenaVector<TimeBudget::clock::duration> actionTimes_{arena_.resource()}; // getAction duration per tank (parallel collection)
+
+        // Event shell engine scratch
+        ArenaVector<uint8_t> shellTargets_{arena_.resource()}; // Shells about to enter each cell (saturates at 2)
+        ArenaVector<size_t> eventShells_{arena_.resource()}; // Slots resolved one by one, in order
+        ArenaVector<size_t> quietShells_{arena_.resource()}; // Slots that only move into an empty cell
+        ArenaVector<uint8_t> quietSlot_{arena_.resource()}; // 1 for the slots in quietShells_ still quiet
+
+        // Banded shell engine: one band of board rows per work item. Band buffers only grow on the game
+        // thread (the arena is not thread-safe), so workers write within reserved capacity.
+        struct ShellBand {
+            explicit ShellBand(std::pmr::memory_resource* resource)
+                : shells(resource), halo(resource), quiet(resource), undo(resource), stale(resource) {}
+            ArenaVector<size_t> shells; // Live slots on the band's cells, in slot order
+            ArenaVector<int> halo; // Cells in another band that the band's shells are about to enter
+            ArenaVector<size_t> quiet; // Quiet shells of the band, in slot order
+            ArenaVector<pair<int, char>> undo; // Board writes of the band's quiet moves, merged into undoLog_
+            ArenaVector<int> stale; // Cells newly flagged in staleCell_ by those writes
+            uint64_t hash = 0; // Change of boardHash_ from those writes
+        };
+        ArenaVector<ShellBand> bands_{arena_.resource()}; // Empty unless the banded engine splits this board
+        int bandRows_ = 0; // Board rows per band (the last band may have fewer)
+        size_t bandedMinShells_ = 0; // Fewer live shells than this and a half-step is not split
+
+        // Replay recording and re-simulation
+        ReplayWriter replay_; // Open while recording a replay
+        size_t keyframeInterval_ = 1; // Turns between two replay keyframes
+        ReplayKeyframe keyframe_; // Scratch keyframe reused while recording
+        bool scripted_ = false; // Actions come from scriptedActions_ instead of the tank algorithms
+        vector<pair<ActionRequest, bool>> scriptedActions_; // Actions (and expected flags) of the current turn
+        bool scriptDiverged_ = false; // Resulting ignore flags differ from scriptedActions_
 
         // bool visualMode_; // Visualisation
 
         // Base functions
         void getTankActions();
-        bool performAction(ActionRequest action, TankInfo& tank);
+        void getTankActionsParallel();
+        bool allAlgorithmsThreadSafe() const;
+        bool allAlgorithmsStateless() const;
+        bool performAction(ActionRequest action, size_t tank);
         void performTankActions();
         void checkTanksStatus();
-        void moveShells(vector<unique_ptr<Shell>>& shells);
+        void moveShells(size_t from = 0);
+        void moveShellsEventDriven();
+        bool resolveEventShells(size_t& moved);
+        void demoteQuietShells(int cell, size_t current);
+        void moveShellsBanded();
+        void setupBands();
+        size_t bandOf(int cell) const { return static_cast<size_t>(cell / width_ / bandRows_); }
+        bool advanceShell(size_t& slot);
+        bool isQuietShell(size_t slot) const;
+        void moveQuietShell(size_t slot);
+        void moveQuietShell(size_t slot, ShellBand& band);
         void checkShellsCollide();
-        int getTankIndexAt(int x, int y) const;
-        bool isValidAction(const TankInfo& tank, ActionRequest action) const;
-        bool isValidShoot(const TankInfo& tank) const;
-        bool isValidMove(const TankInfo& tank, ActionRequest action) const;
-        void shoot(TankInfo& tank);
-        void moveTank(TankInfo& tank, ActionRequest action);
-        void rotate(TankInfo& tank, ActionRequest action);
-        ShellIterator getShellAt(int x, int y);
-        ShellIterator deleteShell(ShellIterator it);
+        int getTankIndexAt(int cell) const;
+        bool isValidAction(size_t tank, ActionRequest action) const;
+        bool isValidShoot(size_t tank) const;
+        bool isValidMove(size_t tank, ActionRequest action) const;
+        void shoot(size_t tank);
+        void moveTank(size_t tank, ActionRequest action);
+        void rotate(size_t tank, ActionRequest action);
+        int getShellAt(int cell) const;
 
         // Support functions
-        pair<int, int> nextLocation(int x, int y, Direction dir, bool backwards = false) const;
-        void printBoard() const;
-        static string getEnumName(Direction dir);
-        static string getEnumName(ActionRequest action) ;
-        void updateGameLog();
-        void updateGameResult(int winner, int reason, vector<size_t> remaining_tanks,
-            vector<vector<char>>& game_state, size_t rounds);
+        void buildNeighborTable();
+        void reserveTurnState();
+        void freeGameMemory();
+        void setBoardCell(int cell, char value);
+        void writeBoardCell(int cell, char value, ArenaVector<pair<int, char>>& undo, ArenaVector<int>& stale, uint64_t& hash);
+        void syncLastRoundGameboard();
+        void rehashBoard();
+        void skipCycles();
+        int cellOf(int x, int y) const { return y * width_ + x; }
+        pair<int, int> locationOf(int cell) const { return {cell % width_, cell / width_}; }
+        int neighborOf(int cell, Direction dir) const {
+            return neighbors_.empty() ? wrapNeighbor(cell, dir) : neighbors_[static_cast<size_t>(cell) * 8 + static_cast<size_t>(dir)];
+        }
+        int wrapNeighbor(int cell, Direction dir) const;
+        static string_view getEnumName(Direction dir);
+        static string_view getEnumName(ActionRequest action);
+        template <typename LogPolicy, typename StatsPolicy> void playGame(size_t max_turns);
+        template <typename LogPolicy, typename StatsPolicy = NoStats> void playTurn();
+        template <typename LogPolicy> void updateGameLog();
+        template <typename LogPolicy> bool forfeitOverBudget();
+        void updateGameResult(int winner, int reason, vector<size_t> remaining_tanks, size_t rounds);
         bool initiateGame(const SatelliteView& gameBoard);
-        void handleTankCollisionAt( TankInfo& tank, int old_x, int old_y, int new_x, int new_y, Direction dir, char next_cell);
-        void clearPreviousShellPosition(Shell& shell);
-        bool handleShellSpawnOnTank(Shell& shell, ShellIterator& it);
-        bool handleShellCollision(Shell& shell, int x, int y, Direction dir, ShellIterator& it);
-        void handleShellMoveToNextCell(Shell& shell, int x, int y, char next_cell, ShellIterator& it);
+        void handleTankCollisionAt(size_t tank, int old_cell, int new_cell, Direction dir, char next_cell);
+        void clearPreviousShellPosition(size_t slot, int cell);
+        bool handleShellSpawnOnTank(int cell, size_t& slot);
+        bool handleShellCollision(int new_cell, Direction dir, size_t& slot);
+        void handleShellMoveToNextCell(int new_cell, char next_cell, size_t& slot);
         void openVerboseLog(const std::string& mapName,
                                             const std::string& player1Name,
                                             const std::string& player2Name,
                                             size_t maxSteps,
                                             size_t numShells);
         void closeVerboseLog();
+        void finishGame();
+        void openReplay(const string& map_name, const string& name1, const string& name2);
+        void writeStats(const string& map_name, const string& name1, const string& name2) const;
+        void captureKeyframe(ReplayKeyframe& keyframe) const;
+        void restoreKeyframe(const ReplayHeader& header, const ReplayKeyframe& keyframe);
+        void getScriptedActions();
     };
 }
\ No newline at end of file
@@ -0,0 +1,107 @@
+#pragma once
+
+# include <atomic>
+# include <cstddef>
+# include <memory>
+# include <memory_resource>
+# include <mutex>
+# include <optional>
+# include <unordered_map>
+# include <vector>
+
+using std::vector, std::shared_ptr;
+
+// Containers of per-game engine state, drawing from a GameArena
+template <typename T> using ArenaVector = std::pmr::vector<T>;
+template <typename K, typename V> using ArenaMap = std::pmr::unordered_map<K, V>;
+
+// Hands a container's memory back to its allocator; clear() would keep the capacity
+template <typename Container> void freeArenaMemory(Container& container) {
+    Container(container.get_allocator()).swap(container);
+}
+
+// Per-thread memory for the state of the games played on that thread. Containers allocate from a
+// pool on top of a monotonic buffer. When the last game of the thread lets go and nothing allocated
+// from the arena is still alive, the whole arena is dropped at once and the buffer is kept, grown to
+// the last peak (up to kMaxRetainedBytes), so the next game on the thread builds its state without
+// going to the global heap. Until then, large blocks freed into the monotonic buffer are not reused.
+// The arena lives as long as a lease holds it: once the thread's last game manager is destroyed, the
+// buffer goes with it, and the next game manager on the thread starts a new arena.
+class GameArena {
+public:
+    static constexpr size_t kMaxRetainedBytes = size_t{64} << 20; // Larger peaks are not kept between games
+
+    // Holds the thread's arena for one game manager; declare it before the containers it feeds.
+    // The arena only resets while no lease is held, so a game manager that outlives its game
+    // (reused for the next one) must free the containers it fed and then renew() its lease,
+    // or the arena keeps every block of every game it played.
+    class Lease {
+    public:
+        // Rule of five:
+        Lease(); // Constructor, takes the calling thread's arena
+        Lease(const Lease&) = delete; // Copy constructor
+        Lease& operator=(const Lease&) = delete; // Copy assignment
+        Lease(Lease&&) noexcept = delete; // Move constructor
+        Lease& operator=(Lease&&) noexcept = delete; // Move assignment
+        ~Lease(); // Destructor, the last lease of an arena resets it
+
+        void renew(); // Let go of the arena and take it again, resetting it if this was the last lease
+        std::pmr::memory_resource* resource() const { return resource_; } // Allocator of the arena
+        const GameArena& arena() const { return *arena_; }
+
+    private:
+        shared_ptr<GameArena> arena_; // Kept alive while leased, and freed with the last lease
+        std::pmr::memory_resource* resource_; // Pool the containers allocate from
+    };
+
+    // Rule of five:
+    GameArena(); // Constructor
+    GameArena(const GameArena&) = delete; // Copy constructor
+    GameArena& operator=(const GameArena&) = delete; // Copy assignment
+    GameArena(GameArena&&) noexcept = delete; // Move constructor
+    GameArena& operator=(GameArena&&) noexcept = delete; // Move assignment
+    ~GameArena() = default; // Destructor
+
+    static shared_ptr<GameArena> forThisThread(); // Arena of the calling thread, new if no lease holds one
+
+    size_t getRetainedBytes() const { return buffer_.size(); } // Buffer kept between games
+    size_t getHeldBytes() const { return buffer_.size() + overflow_.bytes; } // Buffer and heap chunks held right now
+    size_t getLiveBytes() const { return tracker_.bytes; } // Allocated by containers and not freed yet
+    size_t getResets() const { return resets_; } // Times the arena was dropped
+
+private:
+    // Front of the pool: counts the bytes in use, so a reset never pulls memory from under a container
+    class TrackingResource final : public std::pmr::memory_resource {
+    public:
+        explicit TrackingResource(GameArena& arena) : arena_(arena) {}
+        std::atomic<size_t> bytes = 0; // Allocated and not freed yet
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+        GameArena& arena_;
+    };
+
+    // Upstream of the monotonic buffer: the heap, counting what the buffer could not hold
+    class OverflowResource final : public std::pmr::memory_resource {
+    public:
+        size_t bytes = 0; // Bytes taken from the heap since the last reset
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override;
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+    };
+
+    std::pmr::memory_resource* acquire(); // A game starts using the arena
+    void release(); // A game let go; the last one resets the arena
+    void rebuild(); // Fresh resources over buffer_
+
+    std::mutex mutex_; // Guards users_ and the rebuilds
+    size_t users_ = 0; // Live leases
+    size_t resets_ = 0;
+    vector<std::byte> buffer_; // Memory kept between games
+    OverflowResource overflow_;
+    std::optional<std::pmr::monotonic_buffer_resource> monotonic_;
+    std::optional<std::pmr::synchronized_pool_resource> pool_;
+    TrackingResource tracker_{*this}; // What the leases hand out
+};
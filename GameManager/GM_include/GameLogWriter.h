@@ -0,0 +1,39 @@
+#pragma once
+
+# include <cstddef>
+# include <fstream>
+# include <string>
+# include <string_view>
+
+using std::string, std::string_view, std::ofstream;
+
+// Write-behind writer for the verbose game log. Text is appended to an in-memory buffer that is
+// handed to the file in large chunks (and once more on close), instead of flushing every turn.
+class GameLogWriter {
+public:
+    static constexpr size_t kChunkSize = 1 << 16; // Buffered bytes that trigger a write to the file
+
+    // Rule of five:
+    GameLogWriter() = default; // Constructor
+    GameLogWriter(const GameLogWriter&) = delete; // Copy constructor
+    GameLogWriter& operator=(const GameLogWriter&) = delete; // Copy assignment
+    GameLogWriter(GameLogWriter&&) noexcept = delete; // Move constructor
+    GameLogWriter& operator=(GameLogWriter&&) noexcept = delete; // Move assignment
+    ~GameLogWriter() { close(); } // Destructor, writes whatever is still buffered
+
+    bool open(const string& path); // Open (and truncate) the log file
+    bool is_open() const { return file_.is_open(); } // Whether a log file is open
+    void flush(); // Write the buffer to the file
+    void close(); // Flush and close the file
+
+    GameLogWriter& operator<<(string_view text); // Append text
+    GameLogWriter& operator<<(char c); // Append one character
+    GameLogWriter& operator<<(int value); // Append a decimal number
+    GameLogWriter& operator<<(size_t value); // Append a decimal number
+
+private:
+    void flushIfFull() { if (buffer_.size() >= kChunkSize) { flush(); } } // Write out a full chunk
+
+    ofstream file_; // Log file
+    string buffer_; // Pending output
+};
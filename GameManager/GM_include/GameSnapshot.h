@@ -0,0 +1,43 @@
+#pragma once
+
+# include "TankRegistry.h"
+# include "ShellPool.h"
+# include <cstddef>
+# include <vector>
+
+using std::vector;
+
+// Engine state of a game between two turns: board, tanks, shells, counters, turn and, once the
+// game is decided, its result.
+// Every buffer holds trivially copyable values, so taking a snapshot into an existing one and
+// restoring from it are plain array copies that reuse the buffers' capacity.
+struct GameSnapshot {
+    vector<char> board; // Row-major board
+    TankRegistry::Snapshot tanks; // Per-tank arrays, position grid and counters
+    ShellPool::Snapshot shells; // Shell slots and cell chains
+
+    int width = 0; // Board width
+    int height = 0; // Board height
+    int maxSteps = 0; // Maximum steps for the game
+    int numShells = 0; // Initial shells per tank
+    int turn = 0; // Turn that starts from this state
+    bool gameOver = false; // Whether the game has ended
+    size_t gameOverStatus = 0; // Reason the game ended (see checkTanksStatus)
+    bool noAmmoFlag = false; // All tanks were out of ammo
+    size_t noAmmoTimer = 0; // Turns left on the no-ammo timer
+    size_t numTanks1 = 0; // Player 1 tanks at the last status check
+    size_t numTanks2 = 0; // Player 2 tanks at the last status check
+
+    bool hasResult = false; // The game was decided; the fields below hold its result
+    int winner = 0; // Winning player (0 = tie)
+    int reason = 0; // GameResult::Reason
+    vector<size_t> remainingTanks; // Tanks left per player
+    size_t rounds = 0; // Rounds played
+};
+
+// Whether two snapshots of one game hold the same state apart from the turn and the no-ammo
+// countdown, that is, whether stateless algorithms would play on from both the same way
+inline bool sameCycleState(const GameSnapshot& a, const GameSnapshot& b) {
+    return a.board == b.board && a.tanks == b.tanks && a.shells == b.shells && a.gameOver == b.gameOver &&
+        a.noAmmoFlag == b.noAmmoFlag && a.numTanks1 == b.numTanks1 && a.numTanks2 == b.numTanks2;
+}
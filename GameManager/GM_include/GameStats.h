@@ -0,0 +1,55 @@
+#pragma once
+
+# include <chrono>
+# include <cstddef>
+# include <cstdint>
+# include <string>
+# include <string_view>
+
+using std::string, std::string_view;
+
+// Phases of a turn that are timed separately, in the order playTurn() runs them
+enum class GamePhase : size_t {
+    TankActions, // getTankActions: the algorithms choose their actions
+    PerformActions, // performTankActions: actions applied, battle-info callbacks included
+    MoveShells, // moveShells / moveShellsEventDriven, both half-steps
+    ShellCollisions, // checkShellsCollide, both half-steps
+    GameLog, // updateGameLog
+    TankStatus, // checkTanksStatus
+    Count
+};
+
+// Per-game timings and counters, collected by the game loop when a stats folder is set.
+// Totals only: per-turn figures are the totals divided by the number of turns.
+struct GameStats {
+    static constexpr size_t kPhases = static_cast<size_t>(GamePhase::Count);
+
+    uint64_t phaseNanos[kPhases] = {}; // Time spent in each phase
+    uint64_t battleInfoNanos = 0; // Time spent in Player::updateTankWithBattleInfo (part of PerformActions)
+    size_t turns = 0; // Turns played
+    size_t tankTurns = 0; // Alive tanks, summed over turns
+    size_t shellTurns = 0; // Shells in flight at the end of a turn, summed over turns
+    size_t maxShells = 0; // Most shells in flight at the end of a turn
+    size_t battleInfoRequests = 0; // GetBattleInfo requests handed to a player
+
+    void clear() { *this = GameStats{}; } // Reset every figure
+    void addTime(GamePhase phase, std::chrono::steady_clock::duration elapsed) {
+        phaseNanos[static_cast<size_t>(phase)] += static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    }
+    bool write(const string& path) const; // Write the figures as "key value" lines
+};
+
+string_view phaseName(GamePhase phase); // Name of the engine function behind a phase
+
+// Runs body, and adds its duration to phase when Enabled. With Enabled false this is just body().
+template <bool Enabled, typename Body>
+inline void timePhase(GameStats& stats, GamePhase phase, Body&& body) {
+    if constexpr (Enabled) {
+        const auto start = std::chrono::steady_clock::now();
+        body();
+        stats.addTime(phase, std::chrono::steady_clock::now() - start);
+    } else {
+        body();
+    }
+}
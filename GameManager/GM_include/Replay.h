@@ -0,0 +1,95 @@
+#pragma once
+
+# include "../../common/ActionRequest.h"
+# include "TankRegistry.h"
+# include <cstddef>
+# include <cstdint>
+# include <fstream>
+# include <span>
+# include <string>
+# include <utility>
+# include <vector>
+
+using std::vector, std::string, std::pair, std::ofstream;
+
+// Binary replay of one game: a header, a full keyframe every few turns and, per turn, the tank
+// actions with their ignore flags. Numbers are varints; a turn only stores the tanks whose
+// (action, ignored) pair changed since the previous turn, and every keyframe restarts that chain,
+// so any turn can be rebuilt from the keyframe before it without running the algorithms.
+
+// Fixed facts about a recorded game
+struct ReplayHeader {
+    size_t width = 0; // Board width
+    size_t height = 0; // Board height
+    size_t maxSteps = 0; // Maximum steps for the game
+    size_t numShells = 0; // Initial shells per tank
+    size_t keyframeInterval = 0; // Turns between two keyframes
+    size_t numTanks = 0; // Tanks of both players
+    uint64_t mapFingerprint = 0; // Fingerprint of the initial board (see fingerprintMap)
+};
+
+// Shell fields saved in a keyframe, in slot order
+struct ShellState {
+    int cell = 0; // Shell cell
+    Direction dir = Direction::U; // Shell direction
+    bool aboveMine = false; // Whether the shell is flying over a mine
+};
+
+// Full engine state at the start of a turn
+struct ReplayKeyframe {
+    size_t turn = 0; // Turn that starts from this state
+    vector<char> board; // Row-major board
+    vector<TankState> tanks; // Every tank, in index order
+    vector<ShellState> shells; // Shells in flight, in slot order
+    bool noAmmoFlag = false; // All tanks were out of ammo
+    size_t noAmmoTimer = 0; // Turns left on the no-ammo timer
+    size_t numTanks1 = 0; // Player 1 tanks at the last status check
+    size_t numTanks2 = 0; // Player 2 tanks at the last status check
+};
+
+// 64-bit FNV-1a over the board size and cells, used to tell which map a replay belongs to
+uint64_t fingerprintMap(size_t width, size_t height, const vector<char>& board);
+
+// Encodes a replay and writes it to a file in large chunks
+class ReplayWriter {
+public:
+    static constexpr size_t kChunkSize = 1 << 16; // Buffered bytes that trigger a write to the file
+
+    // Rule of five:
+    ReplayWriter() = default; // Constructor
+    ReplayWriter(const ReplayWriter&) = delete; // Copy constructor
+    ReplayWriter& operator=(const ReplayWriter&) = delete; // Copy assignment
+    ReplayWriter(ReplayWriter&&) noexcept = delete; // Move constructor
+    ReplayWriter& operator=(ReplayWriter&&) noexcept = delete; // Move assignment
+    ~ReplayWriter() { close(); } // Destructor, finishes the file
+
+    bool open(const string& path, const ReplayHeader& header); // Create the file and write the header
+    bool is_open() const { return file_.is_open(); } // Whether a replay is being recorded
+    void writeKeyframe(const ReplayKeyframe& keyframe); // Record the state at the start of a turn
+    void writeTurn(std::span<const pair<ActionRequest, bool>> actions); // Record a turn's actions and flags
+    void close(); // Write the end marker and close the file
+
+private:
+    void flushIfFull(); // Write out a full chunk
+
+    ofstream file_; // Replay file
+    string buffer_; // Pending output
+    vector<uint8_t> lastActions_; // Encoded (action, ignored) per tank in the previous turn
+    size_t turns_ = 0; // Turns recorded so far
+};
+
+// Loads a whole replay into memory
+class ReplayReader {
+public:
+    bool load(const string& path, string& error); // Read and decode a replay file
+
+    const ReplayHeader& getHeader() const { return header_; } // Get the header
+    size_t getTurnCount() const { return turns_.size(); } // Number of recorded turns
+    const ReplayKeyframe& getKeyframeFor(size_t turn) const; // Latest keyframe at or before a turn
+    void getActions(size_t turn, vector<pair<ActionRequest, bool>>& actions) const; // Actions and flags of a turn
+
+private:
+    ReplayHeader header_;
+    vector<ReplayKeyframe> keyframes_; // Keyframes in turn order, the first one is turn 0
+    vector<vector<uint8_t>> turns_; // Encoded (action, ignored) per tank, per turn
+};
@@ -0,0 +1,93 @@
+#pragma once
+
+# include "../UserCommon/UC_include/Direction.h"
+# include "Zobrist.h"
+# include "GameArena.h"
+# include <cstddef>
+# include <cstdint>
+# include <utility>
+# include <vector>
+
+using std::vector, std::pair;
+using namespace UserCommon_209277367_322542887;
+
+// Pooled storage for the shells in flight. Shells live in parallel arrays whose slot order is the
+// order in which they are processed; every cell heads a chain of the slots that sit on it.
+// Removal only tombstones a slot, so slot order (which decides collision outcomes) never changes
+// mid-pass; collapseStacked() drops the tombstones once per half-step.
+class ShellPool {
+public:
+    // Copy of every array of the pool; all element types are trivially copyable.
+    // Its arrays use the default heap unless constructed with a resource.
+    struct Snapshot {
+        ArenaVector<int> cell;
+        ArenaVector<Direction> dir;
+        ArenaVector<uint8_t> aboveMine;
+        ArenaVector<uint8_t> alive;
+        ArenaVector<int> nextInCell;
+        ArenaVector<int> head;
+        size_t aliveCount = 0;
+        bool operator==(const Snapshot&) const = default;
+    };
+
+    // Rule of five:
+    explicit ShellPool(std::pmr::memory_resource* resource = std::pmr::get_default_resource()); // Constructor, arrays allocate from resource
+    ShellPool(const ShellPool&) = delete; // Copy constructor
+    ShellPool& operator=(const ShellPool&) = delete; // Copy assignment
+    ShellPool(ShellPool&&) noexcept = delete; // Move constructor
+    ShellPool& operator=(ShellPool&&) noexcept = delete; // Move assignment
+    ~ShellPool() = default; // Destructor
+
+    void reset(int width, int height); // Remove all shells and size the cell chains
+    void release(); // Remove all shells and hand every array's memory back to the resource
+    void reserve(size_t shells); // Room for this many slots in every array, so add() and collapseStacked() do not allocate
+    size_t add(int cell, Direction dir, bool above_mine = false); // Append a shell, returns its slot
+    void remove(size_t slot); // Tombstone a shell and unlink it from its cell
+
+    size_t end() const { return cell_.size(); } // One past the last slot, including tombstones
+    size_t size() const { return aliveCount_; } // Number of shells in flight
+    bool empty() const { return aliveCount_ == 0; }
+
+    int getShellAt(int cell) const; // Lowest alive slot at cell, -1 if none
+    size_t countAt(int cell) const; // Number of shells at cell
+
+    bool isAlive(size_t slot) const { return alive_[slot]; } // False once removed
+    int getCell(size_t slot) const { return cell_[slot]; } // Get shell cell
+    Direction getDirection(size_t slot) const { return dir_[slot]; } // Get shell direction
+    bool isAboveMine(size_t slot) const { return aboveMine_[slot]; } // Get above-mine flag
+    void setAboveMine(size_t slot, bool above) { aboveMine_[slot] = above; } // Set above-mine flag
+    void setCell(size_t slot, int cell); // Move shell to cell
+
+    // Removes every shell that shares its cell with another one and compacts the survivors
+    // in (x, y) order, matching the order a map keyed by location would produce. The order
+    // comes from two counting passes over the board's sides, not a comparison sort.
+    void collapseStacked(int width, int height);
+
+    uint64_t hash() const; // Zobrist hash of the shells in flight, independent of slot order
+
+    void save(Snapshot& out) const; // Copy the pool into a snapshot, reusing its buffers
+    void load(const Snapshot& in); // Replace the pool with a snapshot
+
+private:
+    void link(size_t slot); // Push slot onto its cell's chain
+    void unlink(size_t slot); // Remove slot from its cell's chain
+    template <typename Key> void bucketSort(const ArenaVector<int>& from, ArenaVector<int>& to, size_t buckets, Key key);
+
+    // Shell data, one entry per slot
+    ArenaVector<int> cell_; // Shell cell (y * width + x)
+    ArenaVector<Direction> dir_; // Shell direction
+    ArenaVector<uint8_t> aboveMine_; // Whether the shell is above a mine
+    ArenaVector<uint8_t> alive_; // Tombstone flag
+    ArenaVector<int> nextInCell_; // Next slot on the same cell, -1 at the end of the chain
+
+    ArenaVector<int> head_; // First slot of each cell's chain, -1 if empty
+    size_t aliveCount_ = 0;
+
+    // Scratch buffers reused by collapseStacked()
+    ArenaVector<int> order_; // Surviving slots
+    ArenaVector<int> sorted_; // Surviving slots sorted by row
+    ArenaVector<size_t> bucketStart_; // Counting sort offsets, one per row or column
+    ArenaVector<int> scratchCell_;
+    ArenaVector<Direction> scratchDir_;
+    ArenaVector<uint8_t> scratchAboveMine_;
+};
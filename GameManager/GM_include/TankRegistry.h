@@ -0,0 +1,128 @@
+#pragma once
+
+# include "TankInfo.h"
+# include "../UserCommon/UC_include/Direction.h"
+# include "Zobrist.h"
+# include "GameArena.h"
+# include <cstdint>
+# include <memory>
+# include <vector>
+
+using std::vector, std::unique_ptr;
+using namespace UserCommon_209277367_322542887;
+
+// Every per-tank field of the registry, used to save and restore a tank (see ReplayKeyframe)
+struct TankState {
+    int id = 0; // Tank ID within its player
+    int playerId = 0; // Player ID
+    int cell = -1; // Tank cell, -1 once destroyed
+    Direction dir = Direction::U; // Tank direction
+    int ammo = 0; // Amount of ammo
+    int turnsToShoot = 0; // Turns to shoot
+    int turnsToBackwards = 0; // Turns until a backwards move happens
+    bool backwardsFlag = false; // Whether the tank still wants to move backwards
+    bool justMovedBackwards = false; // Whether the tank just moved backwards
+    int turnsDead = 0; // Turns since the tank was destroyed, 0 while alive
+};
+
+// Owns every tank of a game. Per-turn fields are kept as parallel arrays indexed by tank index,
+// a cell -> tank grid answers position queries in O(1), and alive/ammo counters are kept per player.
+class TankRegistry {
+public:
+    // Copy of every per-turn array of the registry; all element types are trivially copyable.
+    // Its arrays use the default heap unless constructed with a resource.
+    struct Snapshot {
+        ArenaVector<int> id;
+        ArenaVector<int> cell;
+        ArenaVector<Direction> dir;
+        ArenaVector<int> ammo;
+        ArenaVector<int> playerId;
+        ArenaVector<int> turnsToShoot;
+        ArenaVector<int> turnsToBackwards;
+        ArenaVector<uint8_t> backwardsFlag;
+        ArenaVector<uint8_t> justMovedBackwards;
+        ArenaVector<int> turnsDead;
+        ArenaVector<size_t> newlyDestroyed;
+        ArenaVector<int> grid;
+        ArenaVector<uint8_t> occupancy;
+        size_t alive[3] = {0, 0, 0};
+        size_t noAmmo[3] = {0, 0, 0};
+        bool operator==(const Snapshot&) const = default;
+    };
+
+    // Rule of five:
+    explicit TankRegistry(std::pmr::memory_resource* resource = std::pmr::get_default_resource()); // Constructor, arrays allocate from resource
+    TankRegistry(const TankRegistry&) = delete; // Copy constructor
+    TankRegistry& operator=(const TankRegistry&) = delete; // Copy assignment - deleted due to unique_ptr
+    TankRegistry(TankRegistry&&) noexcept = delete; // Move constructor
+    TankRegistry& operator=(TankRegistry&&) noexcept = delete; // Move assignment
+    ~TankRegistry() = default; // Destructor
+
+    void reset(size_t num_cells); // Remove all tanks and size the position grid
+    void release(); // Remove all tanks and hand every array's memory back to the resource
+    size_t addTank(int id, int cell, int ammo, int player_id, unique_ptr<TankAlgorithm> tank); // Add a tank, returns its index
+    size_t restoreTank(const TankState& state, unique_ptr<TankAlgorithm> tank); // Add a tank in a saved state, returns its index
+    TankState getState(size_t i) const; // Get every per-tank field
+    size_t size() const { return info_.size(); } // Number of tanks (alive and dead)
+
+    int getTankIndexAt(int cell) const; // Lowest alive tank index at cell, -1 if none
+    size_t getAliveCount() const { return alive_[1] + alive_[2]; } // Alive tanks of both players
+    size_t getAliveCount(int player_id) const { return alive_[player_id]; } // Alive tanks of a player
+    size_t getNoAmmoCount() const { return noAmmo_[1] + noAmmo_[2]; } // Alive tanks with no ammo left
+
+    TankInfo& getInfo(size_t i) { return info_[i]; } // Get cold tank data
+    const TankInfo& getInfo(size_t i) const { return info_[i]; }
+    int getCell(size_t i) const { return cell_[i]; } // Get tank cell, -1 once destroyed
+    Direction getDirection(size_t i) const { return dir_[i]; } // Get tank direction
+    int getAmmo(size_t i) const { return ammo_[i]; } // Get amount of ammo
+    int getPlayerId(size_t i) const { return playerId_[i]; } // Get player ID
+    int getTurnsToShoot(size_t i) const { return turnsToShoot_[i]; } // Get turns to shoot
+    int getTurnsToBackwards(size_t i) const { return turnsToBackwards_[i]; } // Get turns to backwards
+    bool isMovingBackwards(size_t i) const { return backwardsFlag_[i]; } // Get backwards flag
+    bool justMovedBackwards(size_t i) const { return justMovedBackwards_[i]; } // Get just moved backwards flag
+    int getIsAlive(size_t i) const { return turnsDead_[i]; } // Get alive flag (0 while alive)
+
+    void setDirection(size_t i, Direction dir) { dir_[i] = dir; } // Set tank direction
+    void setCell(size_t i, int cell); // Move tank to cell and update the grid
+    void decreaseTurnsToShoot(size_t i) { if (turnsToShoot_[i] > 0) --turnsToShoot_[i]; } // Decrease turns to shoot
+    void decreaseTurnsToBackwards(size_t i) { --turnsToBackwards_[i]; } // Decrease turns to backwards
+    void restartTurnsToBackwards(size_t i) { turnsToBackwards_[i] = 2; } // Set turns to backwards to 2
+    void zeroTurnsToBackwards(size_t i) { turnsToBackwards_[i] = 0; } // Set turns to backwards to 0
+    void switchBackwardsFlag(size_t i) { backwardsFlag_[i] = !backwardsFlag_[i]; } // Switch backwards flag
+    void switchJustMovedBackwardsFlag(size_t i) { justMovedBackwards_[i] = !justMovedBackwards_[i]; } // Switch just moved backwards flag
+    void resetTurnsToShoot(size_t i) { turnsToShoot_[i] = 4; } // Resets turns to shoot
+    void decreaseAmmo(size_t i); // Decrease amount of ammo
+    void increaseTurnsDead(size_t i); // Increase turns dead, the first call destroys the tank
+    void settleNewlyDestroyed(); // Advance tanks destroyed this turn to their second dead turn
+
+    uint64_t hash() const; // Zobrist hash of every tank's state
+
+    void save(Snapshot& out) const; // Copy the registry into a snapshot, reusing its buffers
+    void load(const Snapshot& in); // Replace the registry with a snapshot, keeping algorithms of matching tanks
+
+private:
+    void removeFromGrid(size_t i); // Release the tank's grid cell
+
+    // Cold data
+    ArenaVector<TankInfo> info_; // One entry per tank, moved on growth
+
+    // Hot data, one entry per tank
+    ArenaVector<int> cell_; // Tank cell (y * width + x), -1 once destroyed
+    ArenaVector<Direction> dir_; // Tank direction
+    ArenaVector<int> ammo_; // Amount of ammo
+    ArenaVector<int> playerId_; // Player ID
+    ArenaVector<int> turnsToShoot_; // Turns to shoot
+    ArenaVector<int> turnsToBackwards_; // Number of turns until can perform backwards move
+    ArenaVector<uint8_t> backwardsFlag_; // Whether the tank still wants to move backwards
+    ArenaVector<uint8_t> justMovedBackwards_; // Whether the tank just moved backwards
+    ArenaVector<int> turnsDead_; // Turns since the tank was destroyed, 0 while alive
+    ArenaVector<size_t> newlyDestroyed_; // Tanks destroyed since the last settleNewlyDestroyed()
+
+    // Position grid
+    ArenaVector<int> grid_; // Lowest alive tank index per cell, -1 if empty
+    ArenaVector<uint8_t> occupancy_; // Alive tanks per cell
+
+    // Counters, indexed by player ID
+    size_t alive_[3] = {0, 0, 0};
+    size_t noAmmo_[3] = {0, 0, 0};
+};
@@ -0,0 +1,29 @@
+#pragma once
+
+# include <chrono>
+# include <cstddef>
+
+// Time limits on the players' algorithm calls: getAction and the battle-info callbacks.
+// Calls cannot be interrupted, so limits are checked once a call returns: a getAction call over
+// the per-call budget is played as DoNothing, and a player over its per-game budget forfeits.
+// A call that never returns is never caught and blocks the game thread for good. Times are wall
+// clock, so on a loaded machine the same algorithm may stay within a budget in one run and not in
+// another; set budgets with room to spare.
+class TimeBudget {
+public:
+    using clock = std::chrono::steady_clock;
+
+    void reset(size_t action_budget_ms, size_t game_budget_ms); // Set the limits (0 = none) and clear the totals
+    bool enabled() const { return enabled_; } // Whether any limit is set
+    bool chargeAction(int player_id, clock::duration elapsed); // Charge a getAction call, true if it overran
+    void chargeCallback(int player_id, clock::duration elapsed); // Charge a battle-info callback to the game budget
+    bool isExhausted(int player_id) const; // The player went over its per-game budget
+    size_t getOverruns(int player_id) const { return overruns_[player_id]; } // getAction calls that overran
+
+private:
+    clock::duration actionBudget_{}; // Per-call limit on getAction, zero = none
+    clock::duration gameBudget_{}; // Per-player limit on all calls in a game, zero = none
+    clock::duration used_[3] = {}; // Time charged per player (index = player id)
+    size_t overruns_[3] = {0, 0, 0}; // Overrunning getAction calls per player
+    bool enabled_ = false;
+};
@@ -0,0 +1,50 @@
+#pragma once
+
+# include <atomic>
+# include <condition_variable>
+# include <cstddef>
+# include <deque>
+# include <functional>
+# include <mutex>
+# include <thread>
+# include <vector>
+
+using std::function, std::vector;
+
+// Fixed set of worker threads that run parallel-for jobs. Several games may submit jobs at the same
+// time; the submitting thread always works on its own job too, so a job finishes even when every
+// worker is busy with another one.
+class WorkerPool {
+public:
+    explicit WorkerPool(size_t num_threads); // Start the workers
+
+    // Rule of five:
+    WorkerPool(const WorkerPool&) = delete; // Copy constructor
+    WorkerPool& operator=(const WorkerPool&) = delete; // Copy assignment
+    WorkerPool(WorkerPool&&) noexcept = delete; // Move constructor
+    WorkerPool& operator=(WorkerPool&&) noexcept = delete; // Move assignment
+    ~WorkerPool(); // Destructor, stops and joins the workers
+
+    void parallelFor(size_t count, const function<void(size_t)>& body); // Run body(0..count-1), returns when all ran
+    size_t size() const { return threads_.size(); } // Number of worker threads
+
+    static WorkerPool& shared(); // Process-wide pool, one worker per spare hardware thread
+
+private:
+    struct Job {
+        const function<void(size_t)>* body = nullptr; // Work item
+        size_t count = 0; // Number of items
+        std::atomic<size_t> next{0}; // Next item to claim
+        size_t users = 0; // Workers inside the job, guarded by mutex_
+    };
+
+    void workerLoop(); // Take jobs from the queue until stopped
+    static void runItems(Job& job); // Claim and run items until none are left
+
+    std::mutex mutex_;
+    std::condition_variable wake_; // Signalled when a job is queued or the pool stops
+    std::condition_variable left_; // Signalled when a worker leaves a job
+    std::deque<Job*> jobs_; // Jobs that may still have unclaimed items
+    bool stop_ = false;
+    vector<std::thread> threads_;
+};
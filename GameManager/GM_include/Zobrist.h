@@ -0,0 +1,33 @@
+#pragma once
+
+# include <cstdint>
+
+// Parts of the game state that take part in the Zobrist hash
+enum class ZobristFeature : uint64_t {
+    BoardCell = 1, // (cell, symbol)
+    TankCell, // (tank, cell)
+    TankDirection, // (tank, direction)
+    TankAmmo, // (tank, ammo)
+    TankTurnsToShoot, // (tank, turns)
+    TankTurnsToBackwards, // (tank, turns)
+    TankBackwardsFlags, // (tank, backwards | just moved backwards << 1)
+    TankDead, // (tank, 1 once destroyed)
+    Shell, // (cell, direction | above mine << 3)
+    NoAmmo // (0, 1 once every tank ran out of ammo)
+};
+
+// One splitmix64 round, a bijection on 64-bit values
+inline uint64_t zobristMix(uint64_t x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+// Key of one (feature, index, value) triple. Keys are derived with splitmix64 instead of being
+// stored in tables, so they cost no memory per cell and external tools can recompute any hash.
+// Feature, index and value each go through their own round, so no two triples share a key by
+// construction, whatever the size of the board, the tank count or the ammo.
+inline uint64_t zobristKey(const ZobristFeature feature, const uint64_t index, const uint64_t value) {
+    return zobristMix(zobristMix(zobristMix(static_cast<uint64_t>(feature)) ^ index) ^ value);
+}
@@ -1,6 +1,7 @@
 #include "../GM_include/GM_209277367_322542887.h"
 
 #include "../../common/GameManagerRegistration.h"
+#include <limits>
 
 using std::move, std::endl, std::getline, std::make_unique, std::make_pair, fs::path;
 
@@ -9,6 +10,11 @@ REGISTER_GAME_MANAGER(GM_209277367_322542887);
 
 GM_209277367_322542887::GM_209277367_322542887(bool verbose) : verbose_(verbose) {}
 
+// Set engine options, must be called before run() or init()
+void GM_209277367_322542887::setOptions(const GameManagerOptions& options) {
+    options_ = options;
+}
+
 /**
  * @brief Retrieves and stores the next actions for all tanks in the game.
  *
@@ -20,31 +26,96 @@ GM_209277367_322542887::GM_209277367_322542887(bool verbose) : verbose_(verbose)
  *
  * @details
  * - Alive tanks have their action fetched via `getTank()->getAction()`.
+ * - With a time budget set, a call that takes longer than the per-call
+ *   budget is played as `ActionRequest::DoNothing`.
  * - Dead tanks are assigned `ActionRequest::DoNothing`.
  *
  * @param None
  * @return void
  */
 void GM_209277367_322542887::getTankActions() {
+    if (parallelActions_) { getTankActionsParallel(); return; }
     tankActions_.clear();
 
     // Get the actions for both tanks
-    for (const auto & tank : tanks_) {
-        if (tank->getIsAlive() == 0) {
-            ActionRequest action = tank->getTank()->getAction();
+    for (size_t i = 0; i < tanks_.size(); ++i) {
+        if (tanks_.getIsAlive(i) == 0) {
+            TankAlgorithm& tank_algo = *tanks_.getInfo(i).getTank();
+            ActionRequest action;
+            if (!budget_.enabled()) { action = tank_algo.getAction(); }
+            else {
+                const auto start = TimeBudget::clock::now();
+                action = tank_algo.getAction();
+                if (budget_.chargeAction(tanks_.getPlayerId(i), TimeBudget::clock::now() - start)) {
+                    action = ActionRequest::DoNothing; // Too slow, the answer is dropped
+                }
+            }
             tankActions_.emplace_back(action, true);
         }
         else { tankActions_.emplace_back(ActionRequest::DoNothing, false); }
     }
 }
 
+/**
+ * @brief Collects the actions of all alive tanks in parallel.
+ *
+ * Same result as the sequential loop in getTankActions(): the getAction()
+ * calls run on @c WorkerPool::shared(), each writing only its own tank's
+ * slot in @c tankActions_, and time budgets are charged afterwards in tank
+ * index order. Only used when every algorithm is a @c ThreadSafeTankAlgorithm.
+ */
+void GM_209277367_322542887::getTankActionsParallel() {
+    tankActions_.assign(tanks_.size(), {ActionRequest::DoNothing, false});
+    liveTanks_.clear();
+    for (size_t i = 0; i < tanks_.size(); ++i) {
+        if (tanks_.getIsAlive(i) == 0) { liveTanks_.push_back(i); }
+    }
+
+    const bool timed = budget_.enabled();
+    if (timed) { actionTimes_.assign(tanks_.size(), TimeBudget::clock::duration::zero()); }
+
+    WorkerPool::shared().parallelFor(liveTanks_.size(), [this, timed](const size_t k) {
+        const size_t i = liveTanks_[k];
+        TankAlgorithm& tank_algo = *tanks_.getInfo(i).getTank();
+        if (!timed) { tankActions_[i] = {tank_algo.getAction(), true}; return; }
+        const auto start = TimeBudget::clock::now();
+        tankActions_[i] = {tank_algo.getAction(), true};
+        actionTimes_[i] = TimeBudget::clock::now() - start;
+    });
+
+    if (!timed) { return; }
+    for (const size_t i : liveTanks_) {
+        if (budget_.chargeAction(tanks_.getPlayerId(i), actionTimes_[i])) {
+            tankActions_[i].first = ActionRequest::DoNothing; // Too slow, the answer is dropped
+        }
+    }
+}
+
+// Whether every tank's algorithm declared itself safe to run next to the others
+bool GM_209277367_322542887::allAlgorithmsThreadSafe() const {
+    for (size_t i = 0; i < tanks_.size(); ++i) {
+        const TankAlgorithm* tank_algo = tanks_.getInfo(i).getTank().get();
+        if (tank_algo == nullptr || dynamic_cast<const ThreadSafeTankAlgorithm*>(tank_algo) == nullptr) { return false; }
+    }
+    return true;
+}
+
+// Whether every tank's algorithm declared that it keeps no state, so a repeated game state repeats forever
+bool GM_209277367_322542887::allAlgorithmsStateless() const {
+    for (size_t i = 0; i < tanks_.size(); ++i) {
+        const TankAlgorithm* tank_algo = tanks_.getInfo(i).getTank().get();
+        if (tank_algo == nullptr || dynamic_cast<const StatelessTankAlgorithm*>(tank_algo) == nullptr) { return false; }
+    }
+    return true;
+}
+
 /**
  * @brief Checks if a given action is valid for the specified tank.
  *
  * Determines if the requested action can be performed by the tank,
  * validating movement and shooting actions against the current game state.
  *
- * @param tank Reference to the TankInfo object representing the tank.
+ * @param tank Index of the tank in @c tanks_.
  * @param action The requested action to validate.
  * @return true if the action is allowed, false otherwise.
  *
@@ -53,7 +124,7 @@ void GM_209277367_322542887::getTankActions() {
  * - Shooting actions are validated via isValidShoot().
  * - All other actions are considered valid by default.
  */
-bool GM_209277367_322542887::isValidAction(const TankInfo& tank, const ActionRequest action) const {
+bool GM_209277367_322542887::isValidAction(const size_t tank, const ActionRequest action) const {
     switch(action) { // Check if the action is valid based on the tank's requested actions
         case ActionRequest::MoveForward:
         case ActionRequest::MoveBackward:
@@ -75,23 +146,17 @@ bool GM_209277367_322542887::isValidAction(const TankInfo& tank, const ActionReq
  * @param action Requested move action.
  * @return true if movement is allowed, false otherwise.
  */
-bool GM_209277367_322542887::isValidMove(const TankInfo& tank, const ActionRequest action) const {
-    // Get the current location of the tank
-    auto [fst, snd] = tank.getLocation();
-    const int x = fst;
-    const int y = snd;
-    const Direction dir = tank.getDirection(); // Get the direction of the tank
+bool GM_209277367_322542887::isValidMove(const size_t tank, const ActionRequest action) const {
+    // Get the current cell of the tank
+    Direction dir = tanks_.getDirection(tank); // Get the direction of the tank
 
-    // Get the next cell based on the action
-    char next_cell;
     if (action == ActionRequest::MoveBackward) { // If moving backwards, Update the technical direction
-        auto [nx, ny] = nextLocation(x, y, dir, true);
-        next_cell = gameboard_[ny][nx];
-    } else { // If moving forward, Update the technical direction
-        auto [nx, ny] = nextLocation(x, y, dir);
-        next_cell = gameboard_[ny][nx];
+        dir = static_cast<Direction>((static_cast<int>(dir) + 4) % 8);
     }
 
+    // Get the next cell based on the action
+    const char next_cell = gameboard_[neighborOf(tanks_.getCell(tank), dir)];
+
     return next_cell != '#' && next_cell != '$'; // Return true if the next cell is not a wall
 }
 
@@ -103,9 +168,9 @@ bool GM_209277367_322542887::isValidMove(const TankInfo& tank, const ActionReque
  * @param tank Tank to check.
  * @return true if shooting is allowed, false otherwise.
  */
-bool GM_209277367_322542887::isValidShoot(const TankInfo& tank) const {
+bool GM_209277367_322542887::isValidShoot(const size_t tank) const {
     // Check if the tank has ammo and zeroed cooldown
-    return tank.getAmmo() > 0 && tank.getTurnsToShoot() == 0;
+    return tanks_.getAmmo(tank) > 0 && tanks_.getTurnsToShoot(tank) == 0;
 }
 
 /**
@@ -120,54 +185,52 @@ bool GM_209277367_322542887::isValidShoot(const TankInfo& tank) const {
  *
  * @param tank Tank executing the shot.
  */
-void GM_209277367_322542887::shoot(TankInfo& tank) {
+void GM_209277367_322542887::shoot(const size_t tank) {
     if (!isValidShoot(tank)) { // Check if the shoot action is valid
-        tank.decreaseTurnsToShoot();
-        // cout << "Tank " << tank.getPlayerId() << "." << tank.getID() << " Tried to shoot illegally" << endl;
+        tanks_.decreaseTurnsToShoot(tank);
+        // cout << "Tank " << tanks_.getPlayerId(tank) << "." << tanks_.getInfo(tank).getID() << " Tried to shoot illegally" << endl;
         return;
     }
 
-    tank.resetTurnsToShoot(); // Zero the cooldown
-    tank.decreaseAmmo();
+    tanks_.resetTurnsToShoot(tank); // Zero the cooldown
+    tanks_.decreaseAmmo(tank);
 
     // Calculate the new position of the shell based on the tank's direction
-    auto [fst, snd] = tank.getLocation();
-    Direction dir = tank.getDirection();
+    Direction dir = tanks_.getDirection(tank);
+    const int new_cell = neighborOf(tanks_.getCell(tank), dir);
 
     // Switch to check the next cell
-    switch(auto [new_x, new_y] = nextLocation(fst, snd, dir); gameboard_[new_y][new_x]){
+    switch(gameboard_[new_cell]){
         case '#': {// If the next cell is a wall
-            gameboard_[new_y][new_x] = '$'; // Weaken the wall
-            // cout << "Tank " << tank.getPlayerId() << "." << tank.getID() << " Shot and weakened wall at (" << new_x << ", " << new_y << ")" << endl;
+            setBoardCell(new_cell, '$'); // Weaken the wall
+            // cout << "Tank " << tanks_.getPlayerId(tank) << "." << tanks_.getInfo(tank).getID() << " Shot and weakened wall at cell " << new_cell << endl;
             break;}
         case '$': {// If the next cell is a weak wall
-            gameboard_[new_y][new_x] = ' '; // Destroy the wall
-            // cout << "Tank " << tank.getPlayerId() << "." << tank.getID() << " Shot and destroyed wall at (" << new_x << ", " << new_y << ")" << endl;
+            setBoardCell(new_cell, ' '); // Destroy the wall
+            // cout << "Tank " << tanks_.getPlayerId(tank) << "." << tanks_.getInfo(tank).getID() << " Shot and destroyed wall at cell " << new_cell << endl;
             break;}
         case '1': {  // If the next cell is occupied by tank 1
-            gameboard_[new_y][new_x] = 'c'; // Update the game board with the new position of the tank
-            shells_.emplace_back(make_unique<Shell>(new_x, new_y, dir)); // Add the shell to the list of shells
+            setBoardCell(new_cell, 'c'); // Update the game board with the new position of the tank
+            shells_.add(new_cell, dir); // Add the shell to the pool
             break;}
         case '2': {// If the next cell is occupied by tank 2
-            gameboard_[new_y][new_x] = 'd'; // Update the game board with the new position of the destroyed tank
-            shells_.emplace_back(make_unique<Shell>(new_x, new_y, dir)); // Add the shell to the list of shells
+            setBoardCell(new_cell, 'd'); // Update the game board with the new position of the destroyed tank
+            shells_.add(new_cell, dir); // Add the shell to the pool
             break;}
         case '*': { // If the next cell is a shell
-            gameboard_[new_y][new_x] = ' '; // Remove both shells from the game board
-            if (const auto shell_it = getShellAt(new_x, new_y); shell_it != shells_.end()) { // Find the shell at the new position
-                deleteShell(shell_it); // Delete the shell
+            setBoardCell(new_cell, ' '); // Remove both shells from the game board
+            if (const int shell_slot = getShellAt(new_cell); shell_slot != -1) { // Find the shell at the new position
+                shells_.remove(shell_slot); // Delete the shell
             }
-            // cout << "Tank " << tank.getPlayerId() << "." << tank.getID() << " Shot a shell at (" << new_x << ", " << new_y << ")" << endl;
+            // cout << "Tank " << tanks_.getPlayerId(tank) << "." << tanks_.getInfo(tank).getID() << " Shot a shell at cell " << new_cell << endl;
             break; }
         case '@': {// If the next cell is a mine
-            auto shell_loc = pair(new_x, new_y); // Create a new shell location
-            shells_.emplace_back(make_unique<Shell>(shell_loc, dir)); // Add the shell to the list of shells
-            gameboard_[new_y][new_x] = '*'; // Mark the shell's position on the game board
-            shells_.back()->setAboveMine(true); // Set the shell to be above the mine
+            shells_.add(new_cell, dir, true); // Add the shell to the pool, above the mine
+            setBoardCell(new_cell, '*'); // Mark the shell's position on the game board
             break;}
         default: {// If the next cell is empty
-            gameboard_[new_y][new_x] = '*'; // Mark the shell's position on the game board
-            shells_.emplace_back(make_unique<Shell>(new_x, new_y, dir)); // Add the shell to the list of shells
+            setBoardCell(new_cell, '*'); // Mark the shell's position on the game board
+            shells_.add(new_cell, dir); // Add the shell to the pool
             break;}
     }
 }
@@ -183,20 +246,20 @@ void GM_209277367_322542887::shoot(TankInfo& tank) {
  * @param tank Tank to move.
  * @param action Movement action (forward or backward).
  */
-void GM_209277367_322542887::moveTank(TankInfo& tank, const ActionRequest action) {
-    auto [x, y] = tank.getLocation();
-    Direction dir = tank.getDirection();
+void GM_209277367_322542887::moveTank(const size_t tank, const ActionRequest action) {
+    Direction dir = tanks_.getDirection(tank);
+    const int cell = tanks_.getCell(tank);
 
-    gameboard_[y][x] = ' ';
+    setBoardCell(cell, ' ');
 
     if (action == ActionRequest::MoveBackward) {
         dir = static_cast<Direction>((static_cast<int>(dir) + 4) % 8);
     }
 
-    auto [new_x, new_y] = nextLocation(x, y, dir);
-    char next_cell = gameboard_[new_y][new_x];
+    const int new_cell = neighborOf(cell, dir);
+    char next_cell = gameboard_[new_cell];
 
-    handleTankCollisionAt(tank, x, y, new_x, new_y, dir, next_cell);
+    handleTankCollisionAt(tank, cell, new_cell, dir, next_cell);
 }
 
 /**
@@ -211,61 +274,54 @@ void GM_209277367_322542887::moveTank(TankInfo& tank, const ActionRequest action
  * In all destructive outcomes the target cell is cleared.
  *
  * @param tank      The tank being moved/collided.
- * @param old_x     Previous x-coordinate of the tank.
- * @param old_y     Previous y-coordinate of the tank.
- * @param new_x     Target x-coordinate to enter.
- * @param new_y     Target y-coordinate to enter.
+ * @param old_cell  Previous board cell of the tank.
+ * @param new_cell  Target board cell to enter.
  * @param dir       Movement direction of the tank.
- * @param next_cell Board symbol at (new_x, new_y) before resolving the move.
+ * @param next_cell Board symbol at @p new_cell before resolving the move.
  */
 void GM_209277367_322542887::handleTankCollisionAt(
-    TankInfo& tank, int old_x, int old_y,
-    int new_x, int new_y, Direction dir, char next_cell) {
+    const size_t tank, const int old_cell, const int new_cell, Direction dir, char next_cell) {
 
-    const int player_id = tank.getPlayerId();
+    const int player_id = tanks_.getPlayerId(tank);
 
     switch (next_cell) {
         case ' ': {
-            gameboard_[new_y][new_x] = static_cast<char>('0' + player_id);
-            tank.setLocation(new_x, new_y);
+            setBoardCell(new_cell, static_cast<char>('0' + player_id));
+            tanks_.setCell(tank, new_cell);
             break;
         }
         case '@': {
-            int tank_index = getTankIndexAt(old_x, old_y);
-            destroyedTanksIndices_.insert(tank_index);
-            tanks_[tank_index]->increaseTurnsDead();
-            gameboard_[new_y][new_x] = ' ';
+            int tank_index = getTankIndexAt(old_cell);
+            tanks_.increaseTurnsDead(tank_index);
+            setBoardCell(new_cell, ' ');
             break;
         }
         case '*': {
-            ShellIterator shell_it = getShellAt(new_x, new_y);
-            int shell_dir = static_cast<int>((*shell_it)->getDirection());
+            const int shell_slot = getShellAt(new_cell);
+            int shell_dir = static_cast<int>(shells_.getDirection(shell_slot));
 
             if (static_cast<int>(dir) == ((shell_dir + 4) % 8)) {
-                int tank_index = getTankIndexAt(old_x, old_y);
-                destroyedTanksIndices_.insert(tank_index);
-                tanks_[tank_index]->increaseTurnsDead();
-                deleteShell(shell_it);
-                gameboard_[new_y][new_x] = ' ';
+                int tank_index = getTankIndexAt(old_cell);
+                tanks_.increaseTurnsDead(tank_index);
+                shells_.remove(shell_slot);
+                setBoardCell(new_cell, ' ');
             } else {
-                gameboard_[new_y][new_x] = (player_id == 1) ? 'a' : 'b';
-                tank.setLocation(new_x, new_y);
+                setBoardCell(new_cell, (player_id == 1) ? 'a' : 'b');
+                tanks_.setCell(tank, new_cell);
             }
             break;
         }
         default: { // Assume another tank
-            int self_idx = getTankIndexAt(old_x, old_y);
-            int other_idx = getTankIndexAt(new_x, new_y);
+            int self_idx = getTankIndexAt(old_cell);
+            int other_idx = getTankIndexAt(new_cell);
 
-            destroyedTanksIndices_.insert(self_idx);
-            tanks_[self_idx]->increaseTurnsDead();
+            tanks_.increaseTurnsDead(self_idx);
 
             if (other_idx != -1) {
-                destroyedTanksIndices_.insert(other_idx);
-                tanks_[other_idx]->increaseTurnsDead();
+                tanks_.increaseTurnsDead(other_idx);
             }
 
-            gameboard_[new_y][new_x] = ' ';
+            setBoardCell(new_cell, ' ');
             break;
         }
     }
@@ -282,9 +338,9 @@ void GM_209277367_322542887::handleTankCollisionAt(
  * @param tank Tank to rotate.
  * @param action Rotation action request.
  */
-void GM_209277367_322542887::rotate(TankInfo& tank, const ActionRequest action) {
+void GM_209277367_322542887::rotate(const size_t tank, const ActionRequest action) {
     // Get the current direction of the tank
-    Direction dir = tank.getDirection();
+    Direction dir = tanks_.getDirection(tank);
     Direction new_dir = dir;
 
     // Rotate the tank based on the action
@@ -305,7 +361,7 @@ void GM_209277367_322542887::rotate(TankInfo& tank, const ActionRequest action)
             break; // No rotation
     }
 
-    tank.setDirection(new_dir); // Update tanks direction
+    tanks_.setDirection(tank, new_dir); // Update tanks direction
 }
 
 /**
@@ -316,7 +372,7 @@ void GM_209277367_322542887::rotate(TankInfo& tank, const ActionRequest action)
  * and invalid action handling. Also supports retrieving battle info for the tank.
  *
  * @param action The action to perform.
- * @param tank   Reference to the tank performing the action.
+ * @param tank   Index of the tank performing the action.
  * @return true if the action was successfully executed or valid, false otherwise.
  *
  * @note
@@ -325,9 +381,9 @@ void GM_209277367_322542887::rotate(TankInfo& tank, const ActionRequest action)
  * - GetBattleInfo temporarily modifies the gameboard to mark the tank’s position
  *   before restoring it.
  */
-bool GM_209277367_322542887::performAction(const ActionRequest action, TankInfo& tank) {
+bool GM_209277367_322542887::performAction(const ActionRequest action, const size_t tank) {
     // Deal with moving backwards
-    if (tank.justMovedBackwards() && action == ActionRequest::MoveBackward){ // If the tank just moved backwards
+    if (tanks_.justMovedBackwards(tank) && action == ActionRequest::MoveBackward){ // If the tank just moved backwards
         if (isValidAction(tank, ActionRequest::MoveBackward)) { // Check if the action is valid
             moveTank(tank, ActionRequest::MoveBackward);
             return true;
@@ -337,46 +393,46 @@ bool GM_209277367_322542887::performAction(const ActionRequest action, TankInfo&
     }
 
     // Check if tank was moving backwards but now performing other action
-    if (tank.justMovedBackwards() &&
-        action != ActionRequest::MoveBackward) { tank.switchJustMovedBackwardsFlag(); }
+    if (tanks_.justMovedBackwards(tank) &&
+        action != ActionRequest::MoveBackward) { tanks_.switchJustMovedBackwardsFlag(tank); }
 
-    if (action == ActionRequest::MoveBackward && !tank.isMovingBackwards()) { // If tank now starting to move backwards
-        if (tank.justMovedBackwards()){ tank.zeroTurnsToBackwards(); } // Can immediately move backwards
-        tank.switchBackwardsFlag();
+    if (action == ActionRequest::MoveBackward && !tanks_.isMovingBackwards(tank)) { // If tank now starting to move backwards
+        if (tanks_.justMovedBackwards(tank)){ tanks_.zeroTurnsToBackwards(tank); } // Can immediately move backwards
+        tanks_.switchBackwardsFlag(tank);
     }
 
-    if (tank.isMovingBackwards()){ // If tank is moving backwards
-        tank.decreaseTurnsToShoot(); // Decrease turns to shoot anyway
+    if (tanks_.isMovingBackwards(tank)){ // If tank is moving backwards
+        tanks_.decreaseTurnsToShoot(tank); // Decrease turns to shoot anyway
 
         if (action == ActionRequest::MoveForward) { // Tank wants to cancel backwards move
-            tank.switchBackwardsFlag(); // No longer wants to move backwards
-            tank.restartTurnsToBackwards();
+            tanks_.switchBackwardsFlag(tank); // No longer wants to move backwards
+            tanks_.restartTurnsToBackwards(tank);
             return false;
         }
 
-        if (tank.getTurnsToBackwards() == 0) { // If tank is now eligible to move backwards
+        if (tanks_.getTurnsToBackwards(tank) == 0) { // If tank is now eligible to move backwards
             if (isValidAction(tank, ActionRequest::MoveBackward)) { // Check if the action is valid
                 moveTank(tank, ActionRequest::MoveBackward);
-                tank.switchJustMovedBackwardsFlag();
+                tanks_.switchJustMovedBackwardsFlag(tank);
             }
 
-            tank.restartTurnsToBackwards();
-            tank.switchBackwardsFlag();
+            tanks_.restartTurnsToBackwards(tank);
+            tanks_.switchBackwardsFlag(tank);
             return false; // Tanks moves, but registered action is ignored
         }
 
         bool succ;
-        if (tank.getTurnsToBackwards() == 2 ) { succ = true; }// Just requested backwards, which is valid
+        if (tanks_.getTurnsToBackwards(tank) == 2 ) { succ = true; }// Just requested backwards, which is valid
         else { succ = false; } // Still waiting for backwards move, current action is ignored
 
-        tank.decreaseTurnsToBackwards(); // Decrease turns to backwards
+        tanks_.decreaseTurnsToBackwards(tank); // Decrease turns to backwards
 
         return succ;
     }
 
     if (!isValidAction(tank, action)) { // Check if the action is valid
-        tank.decreaseTurnsToShoot(); // Decrease turns to shoot if action is invalid
-        // cout << "Tank " << tank.getPlayerId() << "." << tank.getID() << " Invalid action: " << getEnumName(action) << endl;
+        tanks_.decreaseTurnsToShoot(tank); // Decrease turns to shoot if action is invalid
+        // cout << "Tank " << tanks_.getPlayerId(tank) << "." << tanks_.getInfo(tank).getID() << " Invalid action: " << getEnumName(action) << endl;
         return false;
     }
 
@@ -384,31 +440,43 @@ bool GM_209277367_322542887::performAction(const ActionRequest action, TankInfo&
     switch (action) {
         case ActionRequest::MoveForward:
             moveTank(tank, action);
-            tank.decreaseTurnsToShoot();
+            tanks_.decreaseTurnsToShoot(tank);
             break;
         case ActionRequest::Shoot:
             shoot(tank); // Perform the shoot action
             break;
         case ActionRequest::DoNothing:
-            tank.decreaseTurnsToShoot();
+            tanks_.decreaseTurnsToShoot(tank);
             break;
         case ActionRequest::MoveBackward:
             break;
 
         case ActionRequest::GetBattleInfo: { // Get battle info
-            auto* player = (tank.getPlayerId() == 1 ? player1_ : player2_); // Get the player based on tank ID
-            TankAlgorithm& tank_algo = *tank.getTank(); // Get the tank algorithm
-            const char curr_loc = lastRoundGameboard_[tank.getLocation().second][tank.getLocation().first]; // Get the current tank location
-            lastRoundGameboard_[tank.getLocation().second][tank.getLocation().first] = '%'; // Update the gameboard with the tank's position
-            const auto satellite_view = make_unique<ExtSatelliteView>(width_, height_, lastRoundGameboard_); // Create a new satellite view
-            player->updateTankWithBattleInfo(tank_algo, *satellite_view);
-            lastRoundGameboard_[tank.getLocation().second][tank.getLocation().first] = curr_loc; // Restore the tank's position on the gameboard
-            tank.decreaseTurnsToShoot();
+            auto* player = (tanks_.getPlayerId(tank) == 1 ? player1_ : player2_); // Get the player based on tank ID
+            if (player != nullptr) { // Replays are re-simulated without players
+                TankAlgorithm& tank_algo = *tanks_.getInfo(tank).getTank(); // Get the tank algorithm
+                const auto [tank_x, tank_y] = locationOf(tanks_.getCell(tank));
+                syncLastRoundGameboard(); // Bring the last-round board up to date
+                // Shared view over the last-round board, with the tank's cell reported as '%'
+                SharedSatelliteView satellite_view(width_, height_, lastRoundGameboard_.data(), tank_x, tank_y);
+                ++stats_.battleInfoRequests;
+                if (statsEnabled_ || budget_.enabled()) { // Algorithm time inside the PerformActions phase
+                    const auto start = std::chrono::steady_clock::now();
+                    player->updateTankWithBattleInfo(tank_algo, satellite_view);
+                    const auto elapsed = std::chrono::steady_clock::now() - start;
+                    stats_.battleInfoNanos += static_cast<uint64_t>(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+                    budget_.chargeCallback(tanks_.getPlayerId(tank), elapsed);
+                } else {
+                    player->updateTankWithBattleInfo(tank_algo, satellite_view);
+                }
+            }
+            tanks_.decreaseTurnsToShoot(tank);
             break; }
 
         default: // Rotate tank
             rotate(tank, action);
-            tank.decreaseTurnsToShoot();
+            tanks_.decreaseTurnsToShoot(tank);
             break;
     }
 
@@ -431,11 +499,11 @@ void GM_209277367_322542887::performTankActions() {
     // Iterate through all tanks
     for (size_t i = 0; i < tanks_.size(); ++i) {
 
-        // std::cout << "Tank " << tanks_[i]->getPlayerId() << "." << tanks_[i]->getID() << " Performing action: " <<
+        // std::cout << "Tank " << tanks_.getPlayerId(i) << "." << tanks_.getInfo(i).getID() << " Performing action: " <<
         //    getEnumName(tankActions_[i].first) << endl;
 
-        if (tanks_[i]->getIsAlive() == 0) {
-            bool succ = performAction(tankActions_[i].first, *tanks_[i]);
+        if (tanks_.getIsAlive(i) == 0) {
+            bool succ = performAction(tankActions_[i].first, i);
             if (!succ) { tankActions_[i].second = false; }
         }
     }
@@ -444,7 +512,8 @@ void GM_209277367_322542887::performTankActions() {
 /**
  * @brief Checks the current status of all tanks and updates game state flags.
  *
- * Counts remaining alive tanks, checks for ammo depletion, and determines
+ * Reads the registry's running per-player counters (no per-tank scan) to get the
+ * remaining alive tanks, checks for ammo depletion, and determines
  * if the game is over due to no tanks left or one player losing all tanks.
  * Updates flags such as @c noAmmoFlag_, @c gameOver_, and @c gameOverStatus_,
  * as well as player tank counts for logging.
@@ -457,10 +526,10 @@ void GM_209277367_322542887::performTankActions() {
  * - @c noAmmoFlag_ is set if all remaining tanks have zero ammo.
  */
 void GM_209277367_322542887::checkTanksStatus() {
-    const size_t tank_count = tanks_.size() - destroyedTanksIndices_.size();
-    size_t no_ammo_count = 0;
-    size_t player_1_count = 0;
-    size_t player_2_count = 0;
+    const size_t tank_count = tanks_.getAliveCount();
+    const size_t no_ammo_count = tanks_.getNoAmmoCount();
+    const size_t player_1_count = tanks_.getAliveCount(1);
+    const size_t player_2_count = tanks_.getAliveCount(2);
 
     if (tank_count == 0) { // Check not tanks are left
         gameOver_ = true;
@@ -468,18 +537,6 @@ void GM_209277367_322542887::checkTanksStatus() {
         return;
     }
 
-    for (const auto & tank : tanks_) { // Check if tanks are out of ammo
-        if (tank->getIsAlive() == 0 && tank->getAmmo() <= 0) {
-            ++no_ammo_count;
-        }
-
-        if (tank->getPlayerId() == 1 && tank->getIsAlive() == 0) { // Found player 1's tank
-            ++player_1_count;
-        } else if (tank->getPlayerId() == 2 && tank->getIsAlive() == 0) { // Found player 2's tank
-            ++player_2_count;
-        }
-    }
-
     if (no_ammo_count == tank_count) { noAmmoFlag_ = true; } // If tanks are out of ammo, set flag
     if (player_1_count == 0) { // If player 1 is out of tanks
         gameOverStatus_ = 1;
@@ -497,91 +554,318 @@ void GM_209277367_322542887::checkTanksStatus() {
 
 
 /**
- * @brief Finds the index of a tank located at the given coordinates.
+ * @brief Finds the index of a tank located at the given cell.
  *
- * Iterates through @c tanks_ to match the given (x, y) position with a tank's location.
+ * Looks the cell up in the registry's position grid, which holds the lowest
+ * alive tank index per cell.
  *
- * @param x X-coordinate to search.
- * @param y Y-coordinate to search.
- * @return Tank index if found, -1 if no tank is at the given location.
+ * @param cell Board cell to search.
+ * @return Tank index if found, -1 if no tank is at the given cell.
  */
-int GM_209277367_322542887::getTankIndexAt(int x, int y) const {
-    const pair<int, int> tank_loc = make_pair(x, y);
+int GM_209277367_322542887::getTankIndexAt(const int cell) const {
+    return tanks_.getTankIndexAt(cell);
+}
 
-    for (int i = 0; i < static_cast<int>(tanks_.size()); ++i) { // Check if tank is at location
-        if (tanks_[i]->getLocation() == tank_loc) {
-            return i;
-        }
+/**
+ * @brief Finds the shell at the given cell.
+ *
+ * Walks the pool's chain for @p cell, which only holds live shells.
+ *
+ * @param cell Board cell to search.
+ * @return Slot of the first shell at the cell in processing order, -1 if none.
+ */
+int GM_209277367_322542887::getShellAt(const int cell) const {
+    return shells_.getShellAt(cell);
+}
+
+/**
+ * @brief Updates the position of all shells and resolves interactions.
+ *
+ * Walks the shell pool in slot order, moving each live shell based on its
+ * direction and handling collisions or interactions with tanks, other shells,
+ * and various map objects.
+ *
+ * @param from First slot to process (the event engine resumes mid-pass from here).
+ *
+ * @note
+ * - Removed shells are tombstoned, so slot order stays fixed during the pass;
+ *   advanceShell() moves the @c slot cursor.
+ */
+void GM_209277367_322542887::moveShells(const size_t from) {
+    for (size_t slot = from; slot < shells_.end();) {
+        if (!shells_.isAlive(slot)) { ++slot; continue; }
+        if (advanceShell(slot)) return;
     }
-    return -1; // Tank not found
 }
 
 /**
- * @brief Retrieves an iterator to the shell at the specified coordinates.
+ * @brief Moves a single shell one cell and resolves what it runs into.
  *
- * Searches through @c shells_ for a shell whose location matches (x, y).
+ * Calls helper functions to handle spawning on a tank, clearing the previous position,
+ * resolving collisions with other shells, or moving into the next cell.
  *
- * @param x X-coordinate to search.
- * @param y Y-coordinate to search.
- * @return Iterator to the matching shell, or @c shells_.end() if not found.
+ * @param slot Pool slot of a live shell; set to the next slot to process.
+ * @return true if no shells are left and the pass should stop, false otherwise.
  */
-ShellIterator GM_209277367_322542887::getShellAt(const int x, const int y) {
-    for (auto it = shells_.begin(); it != shells_.end(); ++it) { // Check if shell is at location
-        if (auto [fst, snd] = (*it)->getLocation(); fst == x && snd == y) {
-            return it;
-        }
+bool GM_209277367_322542887::advanceShell(size_t& slot) {
+    const Direction dir = shells_.getDirection(slot);
+    const int cell = shells_.getCell(slot);
+    const int new_cell = neighborOf(cell, dir);
+    const char next_cell = gameboard_[new_cell];
+
+    if (handleShellSpawnOnTank(cell, slot)) return false;
+
+    clearPreviousShellPosition(slot, cell);
+
+    if (next_cell == '*') {
+        return handleShellCollision(new_cell, dir, slot);
+    }
+
+    handleShellMoveToNextCell(new_cell, next_cell, slot);
+    return false;
+}
+
+/**
+ * @brief Event-driven variant of moveShells() with identical results.
+ *
+ * Splits the live shells into quiet shells, which only slide from their own
+ * cell into an empty cell that no other shell touches this half-step, and
+ * event shells (everything else). Event shells are resolved one by one in slot
+ * order exactly as moveShells() would (see resolveEventShells()); quiet shells
+ * cannot observe or be observed by them, so the ones still quiet are moved in
+ * bulk afterwards without any collision handling.
+ */
+void GM_209277367_322542887::moveShellsEventDriven() {
+    eventShells_.clear();
+    quietShells_.clear();
+    quietSlot_.assign(shells_.end(), 0);
+
+    // Mark every cell a shell is about to enter
+    for (size_t slot = 0; slot < shells_.end(); ++slot) {
+        if (!shells_.isAlive(slot)) continue;
+        uint8_t& targets = shellTargets_[neighborOf(shells_.getCell(slot), shells_.getDirection(slot))];
+        if (targets < 2) ++targets;
     }
 
-    return shells_.end(); // Return end iterator if no shell found
+    for (size_t slot = 0; slot < shells_.end(); ++slot) {
+        if (!shells_.isAlive(slot)) continue;
+        if (isQuietShell(slot)) { quietSlot_[slot] = 1; quietShells_.push_back(slot); }
+        else { eventShells_.push_back(slot); }
+    }
+
+    for (size_t slot = 0; slot < shells_.end(); ++slot) { // Clear the marks before anything moves
+        if (shells_.isAlive(slot)) shellTargets_[neighborOf(shells_.getCell(slot), shells_.getDirection(slot))] = 0;
+    }
+
+    size_t moved = 0;
+    if (!resolveEventShells(moved)) return;
+
+    for (size_t k = moved; k < quietShells_.size(); ++k) {
+        if (quietSlot_[quietShells_[k]]) moveQuietShell(quietShells_[k]);
+    }
 }
 
 /**
- * @brief Removes a shell from the game.
+ * @brief Resolves @c eventShells_ in slot order, as moveShells() would.
  *
- * Erases the shell at the given iterator position in @c shells_.
+ * If an event shell collides head-on with an earlier shell, moveShells()
+ * resumes right after that earlier shell and processes the shells in between
+ * a second time. The quiet shells passed so far are moved first, then those
+ * slots are replayed stepwise up to the current one, after which event
+ * resolution goes on. A replayed shell may enter the cell of a quiet shell
+ * that has not moved yet; that shell is demoted to an event shell first.
  *
- * @param it Iterator pointing to the shell to remove.
- * @return Iterator to the next element after the erased shell.
+ * @param moved Set to the number of quiet shells (a prefix of @c quietShells_) already passed.
+ * @return true if the quiet shells from @p moved on still have to be moved, false if no shells are left.
  */
-ShellIterator GM_209277367_322542887::deleteShell(ShellIterator it) {
-    if (it != shells_.end()) {
-        it = shells_.erase(it); // Remove the shell from the vector
+bool GM_209277367_322542887::resolveEventShells(size_t& moved) {
+    moved = 0;
+    for (size_t i = 0; i < eventShells_.size();) {
+        size_t slot = eventShells_[i];
+        if (!shells_.isAlive(slot)) { ++i; continue; }
+
+        const size_t processed = slot;
+        if (advanceShell(slot)) return false;
+
+        if (slot > processed) { ++i; continue; } // Continue with the next event shell
+        if (slot == processed) continue; // Shell was not advanced, process it again
+
+        // Resumed before the current shell: catch up the quiet shells passed, then replay up to it
+        for (; moved < quietShells_.size() && quietShells_[moved] < processed; ++moved) {
+            if (quietSlot_[quietShells_[moved]]) moveQuietShell(quietShells_[moved]);
+        }
+        while (slot <= processed) {
+            if (!shells_.isAlive(slot)) { ++slot; continue; }
+            demoteQuietShells(neighborOf(shells_.getCell(slot), shells_.getDirection(slot)), i);
+            if (advanceShell(slot)) return false;
+        }
+        ++i;
     }
+    return true;
+}
+
+/**
+ * @brief Turns the unmoved quiet shells on or entering @p cell into event shells.
+ *
+ * Quiet shells are alone on their cell and the only shell entering their
+ * next cell, so one lookup per neighbor finds them, and no other quiet
+ * shell depends on them. They are inserted into @c eventShells_ after
+ * position @p current, in slot order.
+ */
+void GM_209277367_322542887::demoteQuietShells(const int cell, const size_t current) {
+    auto demote = [this, current](const int slot) {
+        if (slot == -1 || !quietSlot_[slot] || static_cast<size_t>(slot) < eventShells_[current]) return;
+        quietSlot_[slot] = 0;
+        eventShells_.insert(std::lower_bound(eventShells_.begin() + current + 1, eventShells_.end(), slot), slot);
+    };
 
-    return it;
+    demote(getShellAt(cell));
+    for (int d = 0; d < 8; ++d) {
+        const int from = neighborOf(cell, static_cast<Direction>(d));
+        const int slot = getShellAt(from);
+        if (slot != -1 && neighborOf(from, shells_.getDirection(slot)) == cell) demote(slot);
+    }
 }
 
 /**
- * @brief Updates the position of all shells and resolves interactions.
+ * @brief Checks whether a shell only moves into an empty cell this half-step.
  *
- * Iterates over the provided list of shells, moving each one based on its
- * direction and handling collisions or interactions with tanks, other shells,
- * and various map objects.
+ * A shell is quiet when it sits alone on a plain '*' cell (not above a mine),
+ * its next cell is empty with no shell in it, no other shell enters its cell,
+ * and it is the only shell entering the next cell.
  *
- * @param shells Reference to the vector of active shells.
+ * @param slot Pool slot of a live shell.
+ * @return true if the shell can be moved without resolving any interaction.
+ */
+bool GM_209277367_322542887::isQuietShell(const size_t slot) const {
+    const int cell = shells_.getCell(slot);
+    const int new_cell = neighborOf(cell, shells_.getDirection(slot));
+
+    return !shells_.isAboveMine(slot) && new_cell != cell &&
+        gameboard_[cell] == '*' && gameboard_[new_cell] == ' ' &&
+        shellTargets_[cell] == 0 && shellTargets_[new_cell] == 1 &&
+        shells_.countAt(cell) == 1 && shells_.countAt(new_cell) == 0;
+}
+
+// Function to move a quiet shell into its (empty) next cell
+void GM_209277367_322542887::moveQuietShell(const size_t slot) {
+    const int cell = shells_.getCell(slot);
+    const int new_cell = neighborOf(cell, shells_.getDirection(slot));
+
+    setBoardCell(cell, ' ');
+    setBoardCell(new_cell, '*');
+    shells_.setCell(slot, new_cell);
+}
+
+// Function to move a quiet shell on a worker thread, recording its board writes in its band
+void GM_209277367_322542887::moveQuietShell(const size_t slot, ShellBand& band) {
+    const int cell = shells_.getCell(slot);
+    const int new_cell = neighborOf(cell, shells_.getDirection(slot));
+
+    writeBoardCell(cell, ' ', band.undo, band.stale, band.hash);
+    writeBoardCell(new_cell, '*', band.undo, band.stale, band.hash);
+    shells_.setCell(slot, new_cell);
+}
+
+/**
+ * @brief Banded variant of moveShellsEventDriven() with identical results.
  *
- * @note
- * - Calls helper functions to handle spawning on a tank, clearing the previous position,
- *   resolving collisions with other shells, or moving into the next cell.
- * - May remove shells from the list during iteration.
+ * The board is split into horizontal bands of @c bandRows_ rows, and each
+ * live shell belongs to the band of its cell. The bulk phases run with one
+ * band per work item on @c WorkerPool::shared():
+ * - Marking: a band marks the targets of its shells that lie in the band.
+ *   Targets in another band (next to a band border, or across the wrapped
+ *   top and bottom edges) are listed in the band's halo instead, and the
+ *   halo exchange marks them on this thread, band by band.
+ * - Classification: every shell is tested with isQuietShell(). This only
+ *   reads the board, the marks and the pool, so bands do not interact.
+ * - Quiet moves: quiet shells touch pairwise distinct cells (each one sits
+ *   alone on its cell, and its target has no other shell in or entering it),
+ *   so bands move theirs without locks. Each band logs its own board writes.
+ *   Those logs are then merged into @c undoLog_, @c staleCells_ and
+ *   @c boardHash_ in band order.
+ *
+ * Event shells are resolved on this thread by resolveEventShells(), exactly
+ * as in moveShellsEventDriven(); quiet shells it moved early or demoted are
+ * skipped by the bands.
+ * Half-steps with fewer than @c bandedMinShells_ shells, and boards
+ * without bands, go to moveShellsEventDriven() directly.
  */
-void GM_209277367_322542887::moveShells(std::vector<std::unique_ptr<Shell>>& shells) {
-    for (auto it = shells.begin(); it != shells.end();) {
-        Shell& shell = **it;
-        auto [x, y] = shell.getLocation();
-        Direction dir = shell.getDirection();
-        auto [new_x, new_y] = nextLocation(x, y, dir);
-        const char next_cell = gameboard_[new_y][new_x];
-
-        if (handleShellSpawnOnTank(shell, it)) continue;
-
-        clearPreviousShellPosition(shell);
-
-        if (next_cell == '*') {
-            if (handleShellCollision(shell, new_x, new_y, dir, it)) return;
-        } else {
-            handleShellMoveToNextCell(shell, new_x, new_y, next_cell, it);
+void GM_209277367_322542887::moveShellsBanded() {
+    if (bands_.empty() || shells_.size() < bandedMinShells_) { moveShellsEventDriven(); return; }
+
+    // Partition the live shells by band, and give every band room for the worst case
+    for (ShellBand& band : bands_) {
+        band.shells.clear(), band.halo.clear(), band.quiet.clear(), band.undo.clear(), band.stale.clear();
+        band.hash = 0;
+    }
+    for (size_t slot = 0; slot < shells_.end(); ++slot) {
+        if (shells_.isAlive(slot)) bands_[bandOf(shells_.getCell(slot))].shells.push_back(slot);
+    }
+    for (ShellBand& band : bands_) {
+        band.halo.reserve(band.shells.size());
+        band.quiet.reserve(band.shells.size());
+        band.undo.reserve(2 * band.shells.size());
+        band.stale.reserve(2 * band.shells.size());
+    }
+    quietSlot_.assign(shells_.end(), 0);
+
+    WorkerPool& pool = WorkerPool::shared();
+    pool.parallelFor(bands_.size(), [this](const size_t b) { // Mark the targets inside the band
+        ShellBand& band = bands_[b];
+        for (const size_t slot : band.shells) {
+            const int target = neighborOf(shells_.getCell(slot), shells_.getDirection(slot));
+            if (bandOf(target) != b) { band.halo.push_back(target); continue; }
+            if (shellTargets_[target] < 2) ++shellTargets_[target];
+        }
+    });
+    for (const ShellBand& band : bands_) { // Halo exchange
+        for (const int target : band.halo) {
+            if (shellTargets_[target] < 2) ++shellTargets_[target];
+        }
+    }
+
+    pool.parallelFor(bands_.size(), [this](const size_t b) {
+        ShellBand& band = bands_[b];
+        for (const size_t slot : band.shells) {
+            if (isQuietShell(slot)) { quietSlot_[slot] = 1; band.quiet.push_back(slot); }
         }
+    });
+
+    pool.parallelFor(bands_.size(), [this](const size_t b) { // Clear the marks before anything moves
+        for (const size_t slot : bands_[b].shells) {
+            const int target = neighborOf(shells_.getCell(slot), shells_.getDirection(slot));
+            if (bandOf(target) == b) shellTargets_[target] = 0;
+        }
+    });
+    for (const ShellBand& band : bands_) {
+        for (const int target : band.halo) shellTargets_[target] = 0;
+    }
+
+    eventShells_.clear();
+    quietShells_.clear();
+    for (size_t slot = 0; slot < shells_.end(); ++slot) {
+        if (!shells_.isAlive(slot)) continue;
+        if (quietSlot_[slot]) quietShells_.push_back(slot);
+        else eventShells_.push_back(slot);
+    }
+
+    size_t moved = 0;
+    if (!resolveEventShells(moved)) return;
+
+    const size_t first = moved < quietShells_.size() ? quietShells_[moved] : shells_.end(); // First quiet slot not moved yet
+    pool.parallelFor(bands_.size(), [this, first](const size_t b) {
+        ShellBand& band = bands_[b];
+        for (auto it = std::lower_bound(band.quiet.begin(), band.quiet.end(), first); it != band.quiet.end(); ++it) {
+            if (quietSlot_[*it]) moveQuietShell(*it, band);
+        }
+    });
+
+    for (const ShellBand& band : bands_) { // Merge the band logs, in band order
+        undoLog_.insert(undoLog_.end(), band.undo.begin(), band.undo.end());
+        staleCells_.insert(staleCells_.end(), band.stale.begin(), band.stale.end());
+        boardHash_ ^= band.hash;
+        if (!band.undo.empty()) lastRoundSynced_ = false;
     }
 }
 
@@ -594,20 +878,21 @@ void GM_209277367_322542887::moveShells(std::vector<std::unique_ptr<Shell>>& she
  * - If overlapping a damaged tank ('a' or 'b'), restores the original tank ('1' or '2').
  * - Otherwise, clears the cell to an empty space unless it holds a tank or mine.
  *
- * @param shell Reference to the shell whose previous position is being cleared.
+ * @param slot Pool slot of the shell whose previous position is being cleared.
+ * @param cell Board cell currently occupied by the shell.
  */
-void GM_209277367_322542887::clearPreviousShellPosition(Shell& shell) {
-    auto [x, y] = shell.getLocation();
-
-    if (shell.isAboveMine()) {
-        gameboard_[y][x] = '@';
-        shell.setAboveMine(false);
-    } else if (gameboard_[y][x] == '^') {
-        gameboard_[y][x] = '*';
-    } else if (gameboard_[y][x] == 'a' || gameboard_[y][x] == 'b') {
-        gameboard_[y][x] = (gameboard_[y][x] == 'a') ? '1' : '2';
-    } else if (gameboard_[y][x] != '1' && gameboard_[y][x] != '2' && gameboard_[y][x] != '@') {
-        gameboard_[y][x] = ' ';
+void GM_209277367_322542887::clearPreviousShellPosition(const size_t slot, const int cell) {
+    const char board_cell = gameboard_[cell];
+
+    if (shells_.isAboveMine(slot)) {
+        setBoardCell(cell, '@');
+        shells_.setAboveMine(slot, false);
+    } else if (board_cell == '^') {
+        setBoardCell(cell, '*');
+    } else if (board_cell == 'a' || board_cell == 'b') {
+        setBoardCell(cell, (board_cell == 'a') ? '1' : '2');
+    } else if (board_cell != '1' && board_cell != '2' && board_cell != '@') {
+        setBoardCell(cell, ' ');
     }
 }
 
@@ -617,20 +902,17 @@ void GM_209277367_322542887::clearPreviousShellPosition(Shell& shell) {
  * Checks if the shell's current position corresponds to a destroyed tank marker ('c' or 'd').
  * If so, marks the tank as destroyed, updates its state, clears the board cell, and removes the shell.
  *
- * @param shell Reference to the shell being processed.
- * @param it Iterator pointing to the shell in @c shells_.
+ * @param cell Board cell currently occupied by the shell.
+ * @param slot Pool slot of the shell; advanced if the shell is removed.
  * @return true if a shell-tank spawn collision was handled and the shell removed, false otherwise.
  */
-bool GM_209277367_322542887::handleShellSpawnOnTank(Shell& shell, ShellIterator& it) {
-    auto [x, y] = shell.getLocation();
-    char cell = gameboard_[y][x];
-    if (cell == 'c' || cell == 'd') {
-        int tank_index = getTankIndexAt(x, y);
+bool GM_209277367_322542887::handleShellSpawnOnTank(const int cell, size_t& slot) {
+    if (gameboard_[cell] == 'c' || gameboard_[cell] == 'd') {
+        int tank_index = getTankIndexAt(cell);
         if (tank_index != -1) {
-            destroyedTanksIndices_.insert(tank_index);
-            tanks_[tank_index]->increaseTurnsDead();
-            gameboard_[y][x] = ' ';
-            it = shells_.erase(it);
+            tanks_.increaseTurnsDead(tank_index);
+            setBoardCell(cell, ' ');
+            shells_.remove(slot++);
             return true;
         }
     }
@@ -638,43 +920,39 @@ bool GM_209277367_322542887::handleShellSpawnOnTank(Shell& shell, ShellIterator&
 }
 
 /**
- * @brief Resolves a shell–shell collision at (x, y).
+ * @brief Resolves a shell–shell collision at @p new_cell.
  *
  * If the two shells move in opposite directions, removes both shells
- * and clears the board cell. Otherwise, stacks the shells at (x, y)
- * by marking '^' and advances the iterator.
- *
- * @param shell The active shell being advanced.
- * @param x     Target x-coordinate.
- * @param y     Target y-coordinate.
- * @param dir   Direction of the active shell.
- * @param it    Iterator to the active shell; updated if erased.
- * @return true if @c shells_ becomes empty after handling the collision, false otherwise.
+ * and clears the board cell. Otherwise, stacks the shells at @p new_cell
+ * by marking '^' and advances the cursor.
+ *
+ * @param new_cell Target board cell.
+ * @param dir      Direction of the active shell.
+ * @param slot     Pool slot of the active shell; moved to the next shell to process.
+ * @return true if no shells are left after handling the collision, false otherwise.
+ *
+ * @note When the other shell precedes the active one, processing resumes right
+ *       after the other shell, as erasing both from an ordered list would.
  */
-bool GM_209277367_322542887::handleShellCollision(Shell& shell, int x, int y, Direction dir, ShellIterator& it) {
-    ShellIterator other_shell_it = getShellAt(x, y);
-    Direction other_dir = (*other_shell_it)->getDirection();
+bool GM_209277367_322542887::handleShellCollision(const int new_cell, Direction dir, size_t& slot) {
+    const int other_slot = getShellAt(new_cell);
 
     auto areOppositeDirections = [](Direction d1, Direction d2) {
         return static_cast<int>(d1) == (static_cast<int>(d2) + 4) % 8;
     };
 
-    if (areOppositeDirections(dir, other_dir)) {
-        gameboard_[y][x] = ' ';
+    if (other_slot != -1 && areOppositeDirections(dir, shells_.getDirection(other_slot))) {
+        setBoardCell(new_cell, ' ');
 
-        if (it < other_shell_it) {
-            deleteShell(other_shell_it);
-            it = shells_.erase(it);
-        } else {
-            shells_.erase(it);
-            it = deleteShell(other_shell_it);
-        }
+        shells_.remove(other_slot);
+        shells_.remove(slot);
+        slot = (static_cast<int>(slot) < other_slot) ? slot + 1 : other_slot + 1;
 
         return shells_.empty();
     } else {
-        shell.setLocation(x, y);
-        gameboard_[y][x] = '^';
-        ++it;
+        shells_.setCell(slot, new_cell);
+        setBoardCell(new_cell, '^');
+        ++slot;
         return false;
     }
 }
@@ -682,54 +960,51 @@ bool GM_209277367_322542887::handleShellCollision(Shell& shell, int x, int y, Di
 /**
  * @brief Moves a shell into the next cell and applies effects.
  *
- * Updates the board and shell list based on the target cell:
+ * Updates the board and shell pool based on the target cell:
  * - '#': weaken wall to '$' and remove the shell.
  * - '$': destroy wall (set to space) and remove the shell.
- * - '1'/'2': destroy the tank at (x, y), clear the cell, and remove the shell.
- * - '@': place shell above a mine (mark '*', set above-mine flag), advance iterator.
- * - ' ': move shell to (x, y) and mark '*'.
- * - default: no special handling; advance iterator.
- *
- * @param shell   The shell being advanced.
- * @param x       Target x-coordinate.
- * @param y       Target y-coordinate.
- * @param next_cell Board symbol at (x, y).
- * @param it      Iterator to the shell; may be updated if erased.
+ * - '1'/'2': destroy the tank at @p new_cell, clear the cell, and remove the shell.
+ * - '@': place shell above a mine (mark '*', set above-mine flag), advance the cursor.
+ * - ' ': move shell to @p new_cell and mark '*'.
+ * - default: no special handling; advance the cursor.
+ *
+ * @param new_cell  Target board cell.
+ * @param next_cell Board symbol at @p new_cell.
+ * @param slot      Pool slot of the shell; advanced once the shell is handled.
  */
-void GM_209277367_322542887::handleShellMoveToNextCell(Shell& shell, int x, int y, char next_cell, ShellIterator& it) {
+void GM_209277367_322542887::handleShellMoveToNextCell(const int new_cell, char next_cell, size_t& slot) {
     switch (next_cell) {
         case '#':
-            gameboard_[y][x] = '$';
-            it = shells_.erase(it);
+            setBoardCell(new_cell, '$');
+            shells_.remove(slot++);
             break;
         case '$':
-            gameboard_[y][x] = ' ';
-            it = shells_.erase(it);
+            setBoardCell(new_cell, ' ');
+            shells_.remove(slot++);
             break;
         case '1':
         case '2': {
-            int tank_index = getTankIndexAt(x, y);
+            int tank_index = getTankIndexAt(new_cell);
             if (tank_index != -1) {
-                destroyedTanksIndices_.insert(tank_index);
-                tanks_[tank_index]->increaseTurnsDead();
-                gameboard_[y][x] = ' ';
-                it = shells_.erase(it);
+                tanks_.increaseTurnsDead(tank_index);
+                setBoardCell(new_cell, ' ');
+                shells_.remove(slot++);
             }
             break;
         }
         case '@':
-            shell.setLocation(x, y);
-            gameboard_[y][x] = '*';
-            shell.setAboveMine(true);
-            ++it;
+            shells_.setCell(slot, new_cell);
+            setBoardCell(new_cell, '*');
+            shells_.setAboveMine(slot, true);
+            ++slot;
             break;
         case ' ':
-            shell.setLocation(x, y);
-            gameboard_[y][x] = '*';
-            ++it;
+            shells_.setCell(slot, new_cell);
+            setBoardCell(new_cell, '*');
+            ++slot;
             break;
         default:
-            ++it;
+            ++slot;
             break;
     }
 }
@@ -737,39 +1012,84 @@ void GM_209277367_322542887::handleShellMoveToNextCell(Shell& shell, int x, int
 /**
  * @brief Collapses shells that occupy the same cell and updates the board.
  *
- * Groups shells by their (x,y) location. If only one shell exists at a cell,
- * it is kept; if multiple shells share a cell, they are all removed and the
- * board cell is cleared to space.
+ * Uses the pool's per-cell chains to count the shells on each cell. If only
+ * one shell exists at a cell, it is kept; if multiple shells share a cell,
+ * they are all removed and the board cell is cleared to space.
  *
- * @note Rebuilds @c shells_ from the grouped map, removing collided shells.
+ * @note The pool is compacted with survivors ordered by (x, y).
  */
 void GM_209277367_322542887::checkShellsCollide() {
-    map<pair<int, int>, vector<unique_ptr<Shell>>> shell_map;
+    for (size_t slot = 0; slot < shells_.end(); ++slot) {
+        if (shells_.isAlive(slot) && shells_.countAt(shells_.getCell(slot)) > 1) {
+            setBoardCell(shells_.getCell(slot), ' ');
+        }
+    }
 
-    // Create a map to store shells by location
-    for (auto& shell : shells_) {
-        pair<int, int> loc = shell->getLocation();
-        shell_map[loc].emplace_back(std::move(shell));
+    shells_.collapseStacked(width_, height_);
+}
+
+/**
+ * @brief Writes a board cell and records its previous value in the turn's undo log.
+ *
+ * Every in-game board mutation goes through here so that
+ * syncLastRoundGameboard() can rebuild the start-of-turn board without
+ * copying the whole grid each turn, and so that @c boardHash_ stays current.
+ *
+ * @param cell  Flat board index.
+ * @param value New cell symbol.
+ */
+void GM_209277367_322542887::setBoardCell(int cell, char value) {
+    writeBoardCell(cell, value, undoLog_, staleCells_, boardHash_);
+    lastRoundSynced_ = false;
+}
+
+// Write a board cell, logging it into the given undo log, stale list and hash (the turn's own, or a shell band's)
+void GM_209277367_322542887::writeBoardCell(int cell, char value, ArenaVector<pair<int, char>>& undo, ArenaVector<int>& stale,
+                                            uint64_t& hash) {
+    undo.emplace_back(cell, gameboard_[cell]);
+    hash ^= zobristKey(ZobristFeature::BoardCell, static_cast<uint64_t>(cell), static_cast<uint8_t>(gameboard_[cell])) ^
+        zobristKey(ZobristFeature::BoardCell, static_cast<uint64_t>(cell), static_cast<uint8_t>(value));
+    if (!staleCell_[cell]) {
+        staleCell_[cell] = 1;
+        stale.push_back(cell);
     }
+    gameboard_[cell] = value;
+}
 
-    shells_.clear(); // Clear the shells vector of nullptrs
+/**
+ * @brief Rebuilds @c lastRoundGameboard_ as the board at the start of this turn.
+ *
+ * Cells written since the previous sync are first refreshed from
+ * @c gameboard_, then this turn's undo log is replayed backwards. The cells
+ * touched this turn are left marked stale, since they now hold start-of-turn
+ * values that the next sync must refresh. Repeated calls within a turn with no
+ * board writes in between are free.
+ */
+void GM_209277367_322542887::syncLastRoundGameboard() {
+    if (lastRoundSynced_) { return; } // Nothing written since the last sync this turn
 
-    // Iterate over the map to check for collisions
-    for (auto& [loc, shell_lst] : shell_map) {
-        if (shell_lst.size() == 1) {
-            shells_.emplace_back(std::move(shell_lst[0]));
-        }
-        else {
-            gameboard_[loc.second][loc.first] = ' ';
+    for (const int cell : staleCells_) {
+        lastRoundGameboard_[cell] = gameboard_[cell];
+        staleCell_[cell] = 0;
+    }
+    staleCells_.clear();
+
+    for (auto it = undoLog_.rbegin(); it != undoLog_.rend(); ++it) {
+        lastRoundGameboard_[it->first] = it->second;
+        if (!staleCell_[it->first]) {
+            staleCell_[it->first] = 1;
+            staleCells_.push_back(it->first);
         }
     }
+    lastRoundSynced_ = true;
 }
 
 /**
  * @brief Initializes the game board and spawns tanks from a satellite snapshot.
  *
- * Copies all cells from @p gameBoard into @c gameboard_, creates tank
- * algorithms/infos for any '1'/'2' cells (using the respective factories),
+ * Copies all cells from @p gameBoard into the flat @c gameboard_ (and once
+ * into @c lastRoundGameboard_) with @c copyView, which is a memcpy for our own
+ * views. Then builds the toroidal neighbor table, creates tank algorithms/infos for any '1'/'2' cells (using the respective factories),
  * and records their initial locations and ammo. If either side has zero tanks,
  * marks the game as over and writes a brief result to the verbose log.
  *
@@ -781,31 +1101,39 @@ void GM_209277367_322542887::checkShellsCollide() {
  */
 bool GM_209277367_322542887::initiateGame(const SatelliteView& gameBoard) {
     // reset state if this can be called more than once
-    tanks_.clear();
+    tanks_.reset(static_cast<size_t>(width_) * height_);
+    shells_.reset(width_, height_);
+    if (options_.shellEngine != ShellEngine::Stepwise) { shellTargets_.assign(static_cast<size_t>(width_) * height_, 0); }
+    setupBands();
 
     int tank_1_count = 0, tank_2_count = 0;
-    gameboard_.assign(height_, std::vector<char>(width_, ' '));
-
-    for (int i = 0; i < height_; ++i) {
-        for (int j = 0; j < width_; ++j) {
-            char cell = gameBoard.getObjectAt(static_cast<size_t>(j), static_cast<size_t>(i));
-            gameboard_[i][j] = cell; // copy snapshot into our board
-
-            if (cell == '1' || cell == '2') {
-                int player = cell - '0';
-                int& tankCount = (player == 1) ? tank_1_count : tank_2_count;
-                auto& factory = (player == 1) ? player1TankFactory_ : player2TankFactory_;
-
-                auto tank = factory(player, tankCount);
-                auto tankInfo = std::make_unique<TankInfo>(
-                    tankCount, std::make_pair(j, i), numShells_, player, std::move(tank)
-                );
-                tanks_.push_back(std::move(tankInfo));
-                ++tankCount;
-            }
+    gameboard_.resize(static_cast<size_t>(width_) * height_);
+    copyView(gameBoard, static_cast<size_t>(width_), static_cast<size_t>(height_), gameboard_.data()); // copy snapshot into our board
+    buildNeighborTable();
+
+    const int num_cells = static_cast<int>(gameboard_.size());
+    for (int cell_index = 0; cell_index < num_cells; ++cell_index) {
+        const char cell = gameboard_[cell_index];
+        if (cell == '1' || cell == '2') {
+            int player = cell - '0';
+            int& tankCount = (player == 1) ? tank_1_count : tank_2_count;
+            auto& factory = (player == 1) ? player1TankFactory_ : player2TankFactory_;
+
+            auto tank = factory(player, tankCount);
+            tanks_.addTank(tankCount, cell_index, numShells_, player, std::move(tank));
+            ++tankCount;
         }
     }
 
+    lastRoundGameboard_.assign(gameboard_.begin(), gameboard_.end());
+    staleCell_.assign(gameboard_.size(), 0);
+    staleCells_.clear();
+    undoLog_.clear();
+    reserveTurnState();
+    rehashBoard();
+    seenStates_.clear();
+    cycleCheckTurn_ = -1;
+
     // If a side has zero tanks, mark the game as over and log.
     if (tank_1_count == 0 || tank_2_count == 0) {
         if (verbose_) {
@@ -818,22 +1146,104 @@ bool GM_209277367_322542887::initiateGame(const SatelliteView& gameBoard) {
             }
         }
         gameOver_ = true;
-        if (verbose_) { gameLog_.flush(); gameLog_.close(); }
+        if (verbose_) { gameLog_.close(); }
     }
 
     return true;
 }
 
+/**
+ * @brief Sizes every per-turn buffer so that turns do not allocate.
+ *
+ * Shells in flight never exceed the ammo of all tanks, nor one per cell after
+ * a collapse plus one fired per tank, so the shell pool and the event engine
+ * lists get that many slots (at most @c kMaxReservedShells). A turn writes a
+ * few cells per tank and per shell and half-step, which bounds the undo log,
+ * and the stale cell list never holds more than the board (capped like the
+ * neighbor table). Capacity is not given back during a game, so a game that
+ * outgrows a bound grows that buffer once, not every turn.
+ *
+ * With verbose logging off, no @c GetBattleInfo request, and none of the
+ * replay, stats, cycle detection or parallel action options, a turn then
+ * makes no heap allocation, except the turn that ends the game, which builds
+ * the @c GameResult (tests/test_turn_allocations.cpp).
+ */
+void GM_209277367_322542887::reserveTurnState() {
+    const size_t cells = gameboard_.size();
+    const size_t tanks = tanks_.size();
+    const size_t ammo = tanks * std::min(static_cast<size_t>(std::max(numShells_, 0)), cells + 1);
+    const size_t shells = std::min({ammo, cells + tanks, kMaxReservedShells});
+
+    tankActions_.reserve(tanks);
+    liveTanks_.reserve(tanks);
+    actionTimes_.reserve(tanks);
+    shells_.reserve(shells);
+    eventShells_.reserve(shells);
+    quietShells_.reserve(shells);
+    quietSlot_.reserve(shells);
+    undoLog_.reserve(4 * tanks + 8 * shells);
+    staleCells_.reserve(std::min(cells, kNeighborTableMaxCells));
+}
+
+// Hand the last game's per-game containers back to the arena, so renewing the lease can reset it
+void GM_209277367_322542887::freeGameMemory() {
+    freeArenaMemory(bands_);
+    freeArenaMemory(neighbors_);
+    tanks_.release();
+    shells_.release();
+    freeArenaMemory(lastRoundGameboard_);
+    freeArenaMemory(undoLog_);
+    freeArenaMemory(staleCell_);
+    freeArenaMemory(staleCells_);
+    freeArenaMemory(seenStates_);
+    freeArenaMemory(tankActions_);
+    freeArenaMemory(liveTanks_);
+    freeArenaMemory(actionTimes_);
+    freeArenaMemory(shellTargets_);
+    freeArenaMemory(eventShells_);
+    freeArenaMemory(quietShells_);
+    freeArenaMemory(quietSlot_);
+}
+
+/**
+ * @brief Splits the board into shell bands for the banded engine.
+ *
+ * With @c shellBands set in the options, the board gets that many bands (at
+ * most one per row) and every half-step is split. Otherwise there is one band
+ * per thread of @c WorkerPool::shared() plus one for the game thread. Each
+ * band is at least @c kMinBandRows rows high, and half-steps with fewer than
+ * @c kMinBandedShells shells are not split. A board left with a single band
+ * gets none, and the banded engine plays it as the event engine.
+ */
+void GM_209277367_322542887::setupBands() {
+    bands_.clear();
+    if (options_.shellEngine != ShellEngine::Banded) return;
+
+    size_t count = options_.shellBands;
+    bandedMinShells_ = 0;
+    if (count == 0) {
+        count = std::min(WorkerPool::shared().size() + 1, static_cast<size_t>(height_ / kMinBandRows));
+        bandedMinShells_ = kMinBandedShells;
+    }
+    count = std::min(count, static_cast<size_t>(height_));
+    if (count < 2) return;
+
+    bandRows_ = static_cast<int>((static_cast<size_t>(height_) + count - 1) / count);
+    count = (static_cast<size_t>(height_) + bandRows_ - 1) / bandRows_; // Rounding the rows up may leave fewer bands
+    bands_.reserve(count);
+    for (size_t b = 0; b < count; ++b) bands_.emplace_back(arena_.resource());
+}
+
 /**
  * @brief Runs a single Tank Game from initialization to termination.
  *
- * Initializes game dimensions, limits, players, and algorithm factories,
- * builds the initial board via initiateGame(), then executes the main loop
- * until a terminal condition is reached (max steps, all tanks dead, or
- * prolonged zero-ammo state).
+ * A thin wrapper over the steppable API: init(), then step() until the game
+ * is finished, then result(). Termination is max steps, all tanks of a side
+ * dead, or a prolonged zero-ammo state.
  *
  * Per turn:
- * - Snapshots @c gameboard_ to @c lastRoundGameboard_.
+ * - Starts a fresh undo log for the turn (the last-round board is rebuilt
+ *   from it only when a tank requests battle info).
  * - Collects actions (getTankActions) and executes them (performTankActions).
  * - Advances shells and resolves collisions (moveShells, checkShellsCollide).
  * - Logs the state (updateGameLog) and updates win/termination flags
@@ -843,13 +1253,13 @@ bool GM_209277367_322542887::initiateGame(const SatelliteView& gameBoard) {
  * @param map_width  Board width.
  * @param map_height Board height.
  * @param map        Read-only map snapshot used to initialize the game.
- * @param map_name   Map identifier (not used internally here).
+ * @param map_name   Map identifier, used in the names of the files written.
  * @param max_steps  Maximum number of rounds to simulate.
  * @param num_shells Initial shells per tank.
  * @param player1    Player interface for player 1.
- * @param name1      Player 1 display name (not used internally here).
+ * @param name1      Player 1 display name.
  * @param player2    Player interface for player 2.
- * @param name2      Player 2 display name (not used internally here).
+ * @param name2      Player 2 display name.
  * @param player1_tank_algo_factory Factory for player 1 tank algorithms.
  * @param player2_tank_algo_factory Factory for player 2 tank algorithms.
  * @return Final @c GameResult moved out of @c gameResult_.
@@ -858,130 +1268,392 @@ GameResult GM_209277367_322542887::run(size_t map_width, size_t map_height, cons
         size_t max_steps, size_t num_shells, Player& player1, string name1, Player& player2, string name2,
         TankAlgorithmFactory player1_tank_algo_factory, TankAlgorithmFactory player2_tank_algo_factory) {
 
-    (void)name1, (void)name2;
+    init(map_width, map_height, map, std::move(map_name), max_steps, num_shells, player1, std::move(name1),
+        player2, std::move(name2), std::move(player1_tank_algo_factory), std::move(player2_tank_algo_factory));
+    step(std::numeric_limits<size_t>::max());
+    return result();
+}
+
+/**
+ * @brief Sets up a game without playing any turn.
+ *
+ * Builds the board and the tanks, opens the verbose log, the replay and the
+ * stats collection as configured, and arms the time budgets. The players and
+ * the factories are kept for the following step() calls, so they must outlive
+ * the game; the map is only read here.
+ *
+ * @param map_width  Board width.
+ * @param map_height Board height.
+ * @param map        Read-only map snapshot used to initialize the game.
+ * @param map_name   Map identifier, used in the names of the files written.
+ * @param max_steps  Maximum number of rounds to simulate.
+ * @param num_shells Initial shells per tank.
+ * @param player1    Player interface for player 1.
+ * @param name1      Player 1 display name.
+ * @param player2    Player interface for player 2.
+ * @param name2      Player 2 display name.
+ * @param player1_tank_algo_factory Factory for player 1 tank algorithms.
+ * @param player2_tank_algo_factory Factory for player 2 tank algorithms.
+ * @return true if the game has turns to play, false if it already ended.
+ */
+bool GM_209277367_322542887::init(size_t map_width, size_t map_height, const SatelliteView& map, string map_name,
+        size_t max_steps, size_t num_shells, Player& player1, string name1, Player& player2, string name2,
+        TankAlgorithmFactory player1_tank_algo_factory, TankAlgorithmFactory player2_tank_algo_factory) {
+
     width_ = map_width, height_ = map_height, maxSteps_ = max_steps, numShells_ = num_shells, player1_ = &player1, player2_ = &player2;
-    player1TankFactory_ = player1_tank_algo_factory;
-    player2TankFactory_ = player2_tank_algo_factory;
+    player1TankFactory_ = std::move(player1_tank_algo_factory);
+    player2TankFactory_ = std::move(player2_tank_algo_factory);
+    mapName_ = std::move(map_name), name1_ = std::move(name1), name2_ = std::move(name2);
+
+    // Per-game state, so the same instance can play one game after another. The last game's
+    // containers go back to the arena first, so it resets instead of growing with every game.
+    freeGameMemory();
+    arena_.renew();
+    turn_ = 0, gameOver_ = false, gameOverStatus_ = 0;
+    noAmmoFlag_ = false, noAmmoTimer_ = 0;
+    numTanks1_ = 0, numTanks2_ = 0;
+    gameResult_ = GameResult{};
+    hasResult_ = false;
+    scripted_ = false, scriptDiverged_ = false;
+
+    // Cells are int indices; a board with more cells than that cannot be played
+    if (map_height != 0 && map_width > static_cast<size_t>(std::numeric_limits<int>::max()) / map_height) {
+        std::cerr << "Board of " << map_width << "x" << map_height << " cells is too large to play" << endl;
+        gameOver_ = true;
+        return false;
+    }
 
-    string logName = "output_" + map_name + "_GM_209277367_322542887_" + name1 + "_" + name2;
+    string logName = "output_" + mapName_ + "_GM_209277367_322542887_" + name1_ + "_" + name2_;
     if (verbose_) {
-        gameLog_.open(logName, std::ios::out | std::ios::trunc);
-        if (!gameLog_.is_open()) std::cerr << "Failed to open log file: " << logName << endl;
+        if (!gameLog_.open(logName)) std::cerr << "Failed to open log file: " << logName << endl;
     }
-    
 
     initiateGame(map); // Copy game board and initiate tanks
+    parallelActions_ = options_.parallelActions && allAlgorithmsThreadSafe();
+    skipCycles_ = options_.cycleDetection && !verbose_ && allAlgorithmsStateless(); // Every turn needs its log line
 
-    // std::cout << "\nGame Started!" << endl;
+    if (!options_.replayFolder.empty() && !gameOver_) {
+        openReplay(mapName_, name1_, name2_); // Record a binary replay of this game
+    }
 
-    // Game loop
-    while (!gameOver_) { // Main game loop
-        // Set the gameboard to the last round's gameboard
-        lastRoundGameboard_ = gameboard_;
+    stats_.clear();
+    statsEnabled_ = !options_.statsFolder.empty();
+    budget_.reset(options_.actionBudgetMs, options_.gameBudgetMs);
+    budgetReport_ = BudgetReport{};
 
-        // Check if the maximum number of turns has been reached
-        if (turn_ >= maxSteps_) {
-            gameOver_ = true; // Set the game over flag
-            if (verbose_) gameLog_ << "Tie, reached max steps = " << maxSteps_ << ", player 1 has " << numTanks1_ << " tanks, player 2 has "
-               << numTanks2_ << " tanks" << endl;
-            break; // Exit the loop
-        }
-        // std::cout << "\nTurn: " << turn_ << endl; // Print the current turn number
+    if (gameOver_) { finishGame(); } // Decided by the initial board
+    return !gameOver_;
+}
 
-        getTankActions(); // Get actions for both tanks and update battle_info_requested
-        performTankActions(); // Perform actions for both tanks
+/**
+ * @brief Plays up to @p turns turns of a game set up with init().
+ *
+ * Logging and instrumentation are compiled in or out once per call (see
+ * playGame()). When the game ends, the log, replay and stats files are
+ * finished, and result() can be taken. Turns skipped by cycle detection
+ * do not count towards @p turns.
+ *
+ * @param turns Maximum number of turns to play.
+ * @return true while the game is still running.
+ */
+bool GM_209277367_322542887::step(const size_t turns) {
+    if (gameOver_) { return false; }
 
-        for (size_t i = 0; i < 2; ++i) { // Iterate through each tank
-            moveShells(shells_); // Move the shells
-            checkShellsCollide(); // Check for shell collisions
-        }
+    if (verbose_) {
+        if (statsEnabled_) { playGame<VerboseLog, CollectStats>(turns); }
+        else { playGame<VerboseLog, NoStats>(turns); }
+    } else {
+        if (statsEnabled_) { playGame<QuietLog, CollectStats>(turns); }
+        else { playGame<QuietLog, NoStats>(turns); }
+    }
 
-        updateGameLog();
+    if (gameOver_) { finishGame(); }
+    return !gameOver_;
+}
 
-        // std::cout << "\nGame Board after turn " << turn_ << ":" << endl; // Print the game board after each turn
-        // printBoard(); // Print the game board
+// Finish the files of an ended game and stop timing its algorithms
+void GM_209277367_322542887::finishGame() {
+    if (statsEnabled_) { writeStats(mapName_, name1_, name2_); }
+    budgetReport_.overruns[0] = budget_.getOverruns(1), budgetReport_.overruns[1] = budget_.getOverruns(2);
+    budget_.reset(0, 0); // Replays and what-if runs that follow are not timed
+    statsEnabled_ = false;
 
-        checkTanksStatus(); // Check if tanks are out of ammo and check for tanks alive
+    closeVerboseLog(); // Close the verbose log if it was opened
+    replay_.close(); // Finish the replay if one is being recorded
+}
 
-        if (noAmmoFlag_) { // If both tanks are out of ammo
-            noAmmoTimer_--; // Decrease the no ammo timer
-            if (noAmmoTimer_ == 0) { // Check if the timer has reached zero
-                updateGameResult(0, 2, {numTanks1_, numTanks2_}, gameboard_, turn_);
-                gameOver_ = true; // Set game_over to true if both tanks are out of ammo for 40 turns
-            if (verbose_) gameLog_ << "Tie, both players have zero shells for " << 40 << " steps" << endl; // Print message if both tanks are out of ammo
-            }
-        }
+/**
+ * @brief Main game loop, until a terminal condition or @p max_turns turns.
+ *
+ * Instantiated once per logging and instrumentation policy: with @c QuietLog
+ * every log write is discarded at compile time, and with @c NoStats no clock
+ * is read, so games that need neither pay nothing for them.
+ *
+ * With @c options_.cycleDetection on, once a state repeats the game skips
+ * every whole cycle left before the step limit (see skipCycles()), and so
+ * reaches the same max-steps ending without playing those turns. The state
+ * hash does not cover the algorithms' own state, so that only holds when
+ * every tank's algorithm is a @c StatelessTankAlgorithm; other games play
+ * every turn. Nothing is skipped with verbose logging on, since each turn
+ * owes the log a line, nor while a replay is being recorded.
+ *
+ * @tparam LogPolicy @c VerboseLog or @c QuietLog.
+ * @tparam StatsPolicy @c CollectStats or @c NoStats.
+ * @param max_turns Turns to play at most before returning.
+ */
+template <typename LogPolicy, typename StatsPolicy>
+void GM_209277367_322542887::playGame(const size_t max_turns) {
+    for (size_t played = 0; !gameOver_ && played < max_turns; ++played) { // Main game loop
+        playTurn<LogPolicy, StatsPolicy>();
 
-        if (gameOver_) { // Check if the game is over
-            if (gameOverStatus_ == 3) { // Both players are missing tanks
-                updateGameResult(0, 0, {0, 0}, gameboard_, turn_);
-                if (verbose_) gameLog_ << "Tie, both players have zero tanks" <<  endl;
-            } else if (gameOverStatus_ == 1) { // Player 1 has no tanks left
-                updateGameResult(2, 0, {0, numTanks2_}, gameboard_ ,turn_);
-                if (verbose_) gameLog_ << "Player 2 won with " << numTanks2_ << " tanks still alive" << endl;
-            } else if (gameOverStatus_ == 2) { // Player 2 has no tanks left
-                updateGameResult(1, 0, {numTanks1_, 0}, gameboard_ , turn_);
-                if (verbose_) gameLog_ << "Player 1 won with " <<  numTanks1_ << " tanks still alive" << endl;
-            }
+        // A repeated state repeats forever, so whole cycles can be skipped
+        if (skipCycles_ && !gameOver_ && !replay_.is_open()) { skipCycles(); }
+    }
+}
+
+/**
+ * @brief Plays one turn: actions, shells, logging and end-of-game checks.
+ *
+ * Increments @c turn_ unless the game ended during the turn. When a replay
+ * is being recorded, writes a keyframe every @c keyframeInterval_ turns and
+ * the turn's actions. When re-simulating a replay or stepping a what-if run,
+ * the actions come from @c scriptedActions_ instead of the tank algorithms.
+ * With @c CollectStats, each phase is timed into @c stats_ and the turn's
+ * tanks and shells are counted.
+ *
+ * @tparam LogPolicy @c VerboseLog or @c QuietLog.
+ * @tparam StatsPolicy @c CollectStats or @c NoStats.
+ */
+template <typename LogPolicy, typename StatsPolicy>
+void GM_209277367_322542887::playTurn() {
+    constexpr bool timed = StatsPolicy::enabled;
+
+    // Start a new undo log; lastRoundGameboard_ is rebuilt lazily from it
+    undoLog_.clear();
+    lastRoundSynced_ = false;
+
+    // Check if the maximum number of turns has been reached
+    if (turn_ >= maxSteps_) {
+        gameOver_ = true; // Set the game over flag
+        if constexpr (LogPolicy::enabled) gameLog_ << "Tie, reached max steps = " << maxSteps_ << ", player 1 has " << numTanks1_ << " tanks, player 2 has "
+           << numTanks2_ << " tanks" << '\n';
+        return; // End the game
+    }
+    // std::cout << "\nTurn: " << turn_ << endl; // Print the current turn number
+
+    if (replay_.is_open() && turn_ % keyframeInterval_ == 0) { // Keyframe at the start of the turn
+        captureKeyframe(keyframe_);
+        replay_.writeKeyframe(keyframe_);
+    }
+
+    if constexpr (timed) { ++stats_.turns, stats_.tankTurns += tanks_.getAliveCount(); }
+
+    timePhase<timed>(stats_, GamePhase::TankActions, [&] {
+        if (scripted_) { getScriptedActions(); } // Actions from a replay or a what-if run
+        else { getTankActions(); } // Get actions for both tanks and update battle_info_requested
+    });
+    timePhase<timed>(stats_, GamePhase::PerformActions, [&] { performTankActions(); }); // Perform actions for both tanks
+
+    if (replay_.is_open()) { replay_.writeTurn(tankActions_); }
+    else if (scripted_ && !std::equal(tankActions_.begin(), tankActions_.end(), scriptedActions_.begin(), scriptedActions_.end())) {
+        scriptDiverged_ = true;
+    }
 
-            break; // Exit the game loop if the game is over
+    for (size_t i = 0; i < 2; ++i) { // Iterate through each tank
+        timePhase<timed>(stats_, GamePhase::MoveShells, [&] {
+            if (options_.shellEngine == ShellEngine::Event) { moveShellsEventDriven(); } // Move the shells
+            else if (options_.shellEngine == ShellEngine::Banded) { moveShellsBanded(); }
+            else { moveShells(); }
+        });
+        timePhase<timed>(stats_, GamePhase::ShellCollisions, [&] { checkShellsCollide(); }); // Check for shell collisions
+    }
+
+    if constexpr (timed) {
+        stats_.shellTurns += shells_.size();
+        stats_.maxShells = std::max(stats_.maxShells, shells_.size());
+    }
+
+    timePhase<timed>(stats_, GamePhase::GameLog, [&] { updateGameLog<LogPolicy>(); });
+
+    // std::cout << "\nGame Board after turn " << turn_ << ":" << endl; // Print the game board after each turn
+    // printBoard(); // Print the game board
+
+    timePhase<timed>(stats_, GamePhase::TankStatus, [&] { checkTanksStatus(); }); // Check if tanks are out of ammo and check for tanks alive
+
+    if (noAmmoFlag_) { // If both tanks are out of ammo
+        noAmmoTimer_--; // Decrease the no ammo timer
+        if (noAmmoTimer_ == 0) { // Check if the timer has reached zero
+            updateGameResult(0, 2, {numTanks1_, numTanks2_}, turn_);
+            gameOver_ = true; // Set game_over to true if both tanks are out of ammo for 40 turns
+        if constexpr (LogPolicy::enabled) gameLog_ << "Tie, both players have zero shells for " << 40 << " steps" << '\n'; // Print message if both tanks are out of ammo
         }
+    }
 
-        ++turn_; // Increment the turn counter
+    if (budget_.enabled() && !gameOver_ && forfeitOverBudget<LogPolicy>()) { return; } // A player ran out of time
+
+    if (gameOver_) { // Check if the game is over
+        if (gameOverStatus_ == 3) { // Both players are missing tanks
+            updateGameResult(0, 0, {0, 0}, turn_);
+            if constexpr (LogPolicy::enabled) gameLog_ << "Tie, both players have zero tanks" << '\n';
+        } else if (gameOverStatus_ == 1) { // Player 1 has no tanks left
+            updateGameResult(2, 0, {0, numTanks2_}, turn_);
+            if constexpr (LogPolicy::enabled) gameLog_ << "Player 2 won with " << numTanks2_ << " tanks still alive" << '\n';
+        } else if (gameOverStatus_ == 2) { // Player 2 has no tanks left
+            updateGameResult(1, 0, {numTanks1_, 0}, turn_);
+            if constexpr (LogPolicy::enabled) gameLog_ << "Player 1 won with " <<  numTanks1_ << " tanks still alive" << '\n';
+        }
+
+        return; // End the game
     }
 
-   closeVerboseLog(); // Close the verbose log if it was opened
+    ++turn_; // Increment the turn counter
+}
 
-    return std::move(gameResult_);
+/**
+ * @brief Ends the game if a player went over its per-game time budget.
+ *
+ * A player over budget forfeits: it is reported with zero tanks, so the
+ * other player wins with the tanks it has left. If both went over in the
+ * same turn, the game is a tie with zero tanks on both sides. The verbose
+ * log gets a line naming the player before the usual result line.
+ *
+ * @tparam LogPolicy @c VerboseLog or @c QuietLog.
+ * @return true if the game ended.
+ */
+template <typename LogPolicy>
+bool GM_209277367_322542887::forfeitOverBudget() {
+    const bool over1 = budget_.isExhausted(1), over2 = budget_.isExhausted(2);
+    if (!over1 && !over2) { return false; }
+
+    gameOver_ = true;
+    budgetReport_.forfeited[0] = over1, budgetReport_.forfeited[1] = over2;
+    if (over1 && over2) {
+        updateGameResult(0, 0, {0, 0}, turn_);
+        if constexpr (LogPolicy::enabled) gameLog_ << "Both players exceeded their time budget" << '\n'
+            << "Tie, both players have zero tanks" << '\n';
+    } else if (over1) {
+        updateGameResult(2, 0, {0, numTanks2_}, turn_);
+        if constexpr (LogPolicy::enabled) gameLog_ << "Player 1 exceeded its time budget" << '\n'
+            << "Player 2 won with " << numTanks2_ << " tanks still alive" << '\n';
+    } else {
+        updateGameResult(1, 0, {numTanks1_, 0}, turn_);
+        if constexpr (LogPolicy::enabled) gameLog_ << "Player 2 exceeded its time budget" << '\n'
+            << "Player 1 won with " << numTanks1_ << " tanks still alive" << '\n';
+    }
+    return true;
 }
 
 /**
- * @brief Calculates the next board coordinates from a starting point and direction.
+ * @brief Precomputes the toroidal neighbor of every cell in every direction.
  *
- * Uses the @c directionMap to translate a @p dir into (dx, dy) offsets.
- * If @p backwards is true, reverses the direction. Wraps around the board
- * edges using modulo width/height to ensure valid coordinates.
+ * Uses the @c directionMap to translate each direction into (dx, dy) offsets
+ * and wraps around the board edges once, so that movement during the game is
+ * a single table lookup (@c neighborOf) instead of a map lookup and two modulos.
+ * Entries are laid out as @c neighbors_[cell * 8 + dir].
  *
- * @param x         Current x-coordinate.
- * @param y         Current y-coordinate.
- * @param dir       Movement direction.
- * @param backwards Whether to move in the opposite direction.
- * @return Pair of (new_x, new_y) coordinates.
+ * The table takes 32 bytes per cell, so boards above @c kNeighborTableMaxCells
+ * get no table and @c neighborOf falls back to @c wrapNeighbor.
  */
-pair<int, int> GM_209277367_322542887::nextLocation(const int x, const int y, const Direction dir, const bool backwards) const {
-    auto [dx, dy] = directionMap.at(dir);
-    if (backwards) { // If the direction is backwards, reverse the direction
-        dx = -dx;
-        dy = -dy;
+void GM_209277367_322542887::buildNeighborTable() {
+    const size_t cells = static_cast<size_t>(width_) * height_;
+    if (cells > kNeighborTableMaxCells) {
+        neighbors_.clear();
+        neighbors_.shrink_to_fit();
+        return;
+    }
+    neighbors_.assign(cells * 8, 0);
+
+    for (const auto& [dir, delta] : directionMap) {
+        const auto [dx, dy] = delta;
+        for (int y = 0; y < height_; ++y) {
+            const int ny = (y + dy + height_) % height_;
+            for (int x = 0; x < width_; ++x) {
+                const int nx = (x + dx + width_) % width_;
+                neighbors_[static_cast<size_t>(cellOf(x, y)) * 8 + static_cast<size_t>(dir)] = cellOf(nx, ny);
+            }
+        }
     }
-    return {(x + dx + width_) % width_, (y + dy + height_) % height_}; // Calculate the next location
+}
+
+/**
+ * @brief Computes the toroidal neighbor of a cell without the neighbor table.
+ *
+ * @param cell Cell index (y * width + x).
+ * @param dir  Direction to step in.
+ * @return Index of the neighboring cell, wrapped around the board edges.
+ */
+int GM_209277367_322542887::wrapNeighbor(const int cell, const Direction dir) const {
+    static constexpr int kDx[8] = {0, 1, 1, 1, 0, -1, -1, -1}; // Indexed by Direction
+    static constexpr int kDy[8] = {-1, -1, 0, 1, 1, 1, 0, -1};
+
+    int x = cell % width_ + kDx[static_cast<size_t>(dir)];
+    int y = cell / width_ + kDy[static_cast<size_t>(dir)];
+    if (x < 0) { x += width_; } else if (x >= width_) { x -= width_; }
+    if (y < 0) { y += height_; } else if (y >= height_) { y -= height_; }
+    return cellOf(x, y);
 }
 
 /**
  * @brief Updates the stored final game result.
  *
- * Sets the winner, reason, remaining tanks per player, final game state,
- * and total number of rounds in @c gameResult_.
+ * Sets the winner, reason, remaining tanks per player and total number of
+ * rounds in @c gameResult_. The final board is attached by result().
  *
  * @param winner          ID of the winning player (0 for tie).
  * @param reason          Integer castable to @c GameResult::Reason.
  * @param remaining_tanks Vector of remaining tanks per player.
- * @param game_state      Final game board state as a SatelliteView.
  * @param rounds          Total rounds played.
  */
-void GM_209277367_322542887::updateGameResult(int winner, int reason, vector<size_t> remaining_tanks,
-    vector<vector<char>>& game_state, size_t rounds) {
+void GM_209277367_322542887::updateGameResult(int winner, int reason, vector<size_t> remaining_tanks, size_t rounds) {
     gameResult_.winner = winner;
     gameResult_.reason = static_cast<GameResult::Reason>(reason);
     gameResult_.remaining_tanks = remaining_tanks;
-    gameResult_.gameState = make_unique<ExtSatelliteView>(width_, height_, game_state);
     gameResult_.rounds = rounds;
+    hasResult_ = true;
+}
+
+/**
+ * @brief Hands the result of the finished game to the caller.
+ *
+ * The final board is moved, not copied, into the result's view as a
+ * @c BoardImage, so after this call the GM's board is empty until the next
+ * init(). Call it once, after the game is finished.
+ *
+ * @return The game result, with the final board when the game was decided.
+ */
+GameResult GM_209277367_322542887::result() {
+    if (hasResult_) {
+        gameResult_.gameState = make_unique<ExtSatelliteView>(BoardImage(width_, height_, std::move(gameboard_)));
+        gameboard_.clear();
+        hasResult_ = false;
+    }
+    return std::move(gameResult_);
+}
+
+/**
+ * @brief Hands a finished game's tank algorithms back to the caller.
+ *
+ * Lets the Simulator reset and reuse them in a later game instead of
+ * creating new ones. The tanks keep their state but have no algorithm until
+ * the next init(), so call it only once the game is over.
+ *
+ * @param player Player (1 or 2) whose algorithms to take.
+ * @return The algorithms, in tank order.
+ */
+vector<unique_ptr<TankAlgorithm>> GM_209277367_322542887::releaseTankAlgorithms(const int player) {
+    vector<unique_ptr<TankAlgorithm>> released;
+    for (size_t i = 0; i < tanks_.size(); ++i) {
+        unique_ptr<TankAlgorithm>& tank_algo = tanks_.getInfo(i).getTank();
+        if (tanks_.getPlayerId(i) == player && tank_algo) { released.push_back(std::move(tank_algo)); }
+    }
+    return released;
 }
 
 // Function to print gameboard
 void GM_209277367_322542887::printBoard() const {
-    for (const auto& row : gameboard_) {
-        for (const auto& cell : row) {
+    for (int y = 0; y < height_; ++y) {
+        for (int x = 0; x < width_; ++x) {
+            const char cell = gameboard_[cellOf(x, y)];
             switch (cell) {
                 case '1': // Tank 1 - Bright Blue
                     std::cout << "\033[94m" << cell << "\033[0m";
@@ -1012,34 +1684,21 @@ void GM_209277367_322542887::printBoard() const {
 }
 
 // Function to translate direction to string
-std::string GM_209277367_322542887::getEnumName(const Direction dir){
-    switch (dir) {
-        case Direction::U:  return "U";
-        case Direction::UR: return "UR";
-        case Direction::R:  return "R";
-        case Direction::DR: return "DR";
-        case Direction::D:  return "D";
-        case Direction::DL: return "DL";
-        case Direction::L:  return "L";
-        case Direction::UL: return "UL";
-        default:            return "Unknown Direction";
-    }
+string_view GM_209277367_322542887::getEnumName(const Direction dir) {
+    static constexpr string_view names[] = {"U", "UR", "R", "DR", "D", "DL", "L", "UL"};
+    const auto i = static_cast<size_t>(dir);
+    return i < std::size(names) ? names[i] : "Unknown Direction";
 }
 
 // Function to translate action to string
-std::string GM_209277367_322542887::getEnumName(const ActionRequest action) {
-    switch (action) {
-        case ActionRequest::MoveForward:     return "MoveForward";
-        case ActionRequest::MoveBackward:    return "MoveBackward";
-        case ActionRequest::RotateLeft90:    return "RotateLeft90";
-        case ActionRequest::RotateRight90:   return "RotateRight90";
-        case ActionRequest::RotateLeft45:    return "RotateLeft45";
-        case ActionRequest::RotateRight45:   return "RotateRight45";
-        case ActionRequest::Shoot:           return "Shoot";
-        case ActionRequest::GetBattleInfo:   return "GetBattleInfo";
-        case ActionRequest::DoNothing:       return "DoNothing";
-        default:                             return "Unknown Action";
-    }
+string_view GM_209277367_322542887::getEnumName(const ActionRequest action) {
+    static constexpr string_view names[] = {
+        "MoveForward", "MoveBackward",
+        "RotateLeft90", "RotateRight90", "RotateLeft45", "RotateRight45",
+        "Shoot", "GetBattleInfo", "DoNothing"
+    };
+    const auto i = static_cast<size_t>(action);
+    return i < std::size(names) ? names[i] : "Unknown Action";
 }
 
 pair<int, int> GM_209277367_322542887::getGameboardSize() const {
@@ -1051,37 +1710,340 @@ pair<int, int> GM_209277367_322542887::getGameboardSize() const {
  *
  * For each tank:
  * - If alive, logs its chosen action (marking "(ignored)" if invalid).
- * - If just killed this turn, logs action with "(killed)" and increments its dead-turn counter.
+ * - If just killed this turn, logs action with "(killed)".
  * - If already dead, logs "killed".
  *
  * Entries are separated by spaces and commas, one turn per log line.
- * Logging occurs only if @c verbose_ is true.
+ * Tanks killed this turn then advance their dead-turn counter; with
+ * @c QuietLog that is all this does, without visiting every tank.
+ *
+ * @tparam LogPolicy @c VerboseLog or @c QuietLog.
  */
+template <typename LogPolicy>
 void GM_209277367_322542887::updateGameLog() {
-    for (int i = 0; i < static_cast<int>(tanks_.size()); ++i) {
-        if (i != 0) { if (verbose_) gameLog_ << " "; }
+    if constexpr (LogPolicy::enabled) {
+        for (int i = 0; i < static_cast<int>(tanks_.size()); ++i) {
+            if (i != 0) { gameLog_ << " "; }
+
+            int tank_state = tanks_.getIsAlive(i);
+            if (tank_state == 0) {
+                gameLog_ << getEnumName(tankActions_[i].first);
+                if (!tankActions_[i].second) { gameLog_ << " (ignored)"; }
+            }
+            else if (tank_state == 1) {
+                if (!tankActions_[i].second) { gameLog_ << " (ignored)"; }
+                gameLog_ << getEnumName(tankActions_[i].first) << " (killed)";
+            }
+            else { gameLog_ << "killed"; }
 
-        int tank_state = tanks_[i]->getIsAlive();
-        if (tank_state == 0) {
-            if (verbose_) gameLog_ << getEnumName(tankActions_[i].first);
-            if (!tankActions_[i].second) { if (verbose_) gameLog_ << " (ignored)"; }
+            if (i != static_cast<int>(tanks_.size()) - 1) { gameLog_ << ","; }
         }
-        else if (tank_state == 1) {
-            if (!tankActions_[i].second) { if (verbose_) gameLog_ << " (ignored)"; }
-            if (verbose_) gameLog_ << getEnumName(tankActions_[i].first) << " (killed)";
-            tanks_[i]->increaseTurnsDead();
-        }
-        else {if (verbose_) gameLog_ << "killed"; }
 
-        if (i != static_cast<int>(tanks_.size()) - 1) { if (verbose_) gameLog_ << ","; }
+        gameLog_ << '\n';
     }
 
-    if (verbose_) gameLog_ << endl;
+    tanks_.settleNewlyDestroyed();
 }
 
 void GM_209277367_322542887::closeVerboseLog() {
     if (verbose_ && gameLog_.is_open()) {
-        gameLog_.flush();
         gameLog_.close();
     }
 }
+
+/**
+ * @brief Starts recording a binary replay of the game that is about to run.
+ *
+ * The file is written to @c options_.replayFolder and named like the verbose
+ * log. Its header fingerprints the initial board so a replay can be matched
+ * to its map.
+ *
+ * @param map_name Map identifier.
+ * @param name1    Player 1 algorithm name.
+ * @param name2    Player 2 algorithm name.
+ */
+void GM_209277367_322542887::openReplay(const string& map_name, const string& name1, const string& name2) {
+    keyframeInterval_ = std::max<size_t>(options_.replayKeyframeInterval, 1);
+
+    ReplayHeader header;
+    header.width = static_cast<size_t>(width_);
+    header.height = static_cast<size_t>(height_);
+    header.maxSteps = static_cast<size_t>(maxSteps_);
+    header.numShells = static_cast<size_t>(numShells_);
+    header.keyframeInterval = keyframeInterval_;
+    header.numTanks = tanks_.size();
+    header.mapFingerprint = fingerprintMap(header.width, header.height, gameboard_);
+
+    const path replay_path = path(options_.replayFolder) /
+        ("replay_" + map_name + "_GM_209277367_322542887_" + name1 + "_" + name2 + ".replay");
+    if (!replay_.open(replay_path.string(), header)) {
+        std::cerr << "Failed to open replay file: " << replay_path.string() << endl;
+    }
+}
+
+// Write stats_ into the stats folder, named like the replay file
+void GM_209277367_322542887::writeStats(const string& map_name, const string& name1, const string& name2) const {
+    const path stats_path = path(options_.statsFolder) /
+        ("stats_" + map_name + "_GM_209277367_322542887_" + name1 + "_" + name2 + ".txt");
+    if (!stats_.write(stats_path.string())) {
+        std::cerr << "Failed to write stats file: " << stats_path.string() << endl;
+    }
+}
+
+// Save the full engine state at the start of the current turn
+void GM_209277367_322542887::captureKeyframe(ReplayKeyframe& keyframe) const {
+    keyframe.turn = static_cast<size_t>(turn_);
+    keyframe.board = gameboard_;
+
+    keyframe.tanks.clear();
+    for (size_t i = 0; i < tanks_.size(); ++i) { keyframe.tanks.push_back(tanks_.getState(i)); }
+
+    keyframe.shells.clear();
+    for (size_t slot = 0; slot < shells_.end(); ++slot) {
+        if (!shells_.isAlive(slot)) { continue; }
+        keyframe.shells.push_back({shells_.getCell(slot), shells_.getDirection(slot), shells_.isAboveMine(slot)});
+    }
+
+    keyframe.noAmmoFlag = noAmmoFlag_;
+    keyframe.noAmmoTimer = noAmmoTimer_;
+    keyframe.numTanks1 = numTanks1_;
+    keyframe.numTanks2 = numTanks2_;
+}
+
+// Load the engine state of a keyframe, without players or tank algorithms
+void GM_209277367_322542887::restoreKeyframe(const ReplayHeader& header, const ReplayKeyframe& keyframe) {
+    width_ = static_cast<int>(header.width), height_ = static_cast<int>(header.height);
+    maxSteps_ = static_cast<int>(header.maxSteps), numShells_ = static_cast<int>(header.numShells);
+    player1_ = nullptr, player2_ = nullptr;
+    const size_t num_cells = header.width * header.height;
+
+    gameboard_ = keyframe.board;
+    buildNeighborTable();
+
+    tanks_.reset(num_cells);
+    for (const TankState& tank : keyframe.tanks) { tanks_.restoreTank(tank, nullptr); }
+    shells_.reset(width_, height_);
+    for (const ShellState& shell : keyframe.shells) { shells_.add(shell.cell, shell.dir, shell.aboveMine); }
+    if (options_.shellEngine != ShellEngine::Stepwise) { shellTargets_.assign(num_cells, 0); }
+    setupBands();
+
+    lastRoundGameboard_.assign(gameboard_.begin(), gameboard_.end());
+    staleCell_.assign(num_cells, 0);
+    staleCells_.clear();
+    undoLog_.clear();
+    rehashBoard();
+
+    turn_ = static_cast<int>(keyframe.turn);
+    gameOver_ = false;
+    gameOverStatus_ = 0;
+    noAmmoFlag_ = keyframe.noAmmoFlag;
+    noAmmoTimer_ = keyframe.noAmmoTimer;
+    numTanks1_ = keyframe.numTanks1;
+    numTanks2_ = keyframe.numTanks2;
+    gameResult_ = GameResult{};
+    hasResult_ = false;
+    seenStates_.clear(); // States of the abandoned timeline
+    cycleCheckTurn_ = -1;
+    skipCycles_ = false; // No tank algorithms
+}
+
+// Take the turn's actions from scriptedActions_ instead of the tank algorithms
+void GM_209277367_322542887::getScriptedActions() {
+    tankActions_.clear();
+    for (size_t i = 0; i < tanks_.size(); ++i) { // Validity is recomputed by performTankActions
+        tankActions_.emplace_back(scriptedActions_[i].first, tanks_.getIsAlive(i) == 0);
+    }
+}
+
+/**
+ * @brief Rebuilds the game state at the start of @p turn from a replay.
+ *
+ * Restores the latest keyframe at or before @p turn and re-simulates the
+ * recorded actions from there; no players or tank algorithms are involved.
+ * The resulting board can be inspected with printBoard().
+ *
+ * @param replay Loaded replay.
+ * @param turn   Turn to seek to, at most @c replay.getTurnCount().
+ * @return false if @p turn is out of range, or if re-simulating did not
+ *         reproduce the recorded ignore flags (the replay was made by a
+ *         different engine).
+ */
+bool GM_209277367_322542887::replayTo(const ReplayReader& replay, const size_t turn) {
+    if (turn > replay.getTurnCount()) { return false; }
+
+    restoreKeyframe(replay.getHeader(), replay.getKeyframeFor(turn));
+    scripted_ = true;
+    scriptDiverged_ = false;
+
+    while (!gameOver_ && static_cast<size_t>(turn_) < turn) {
+        replay.getActions(static_cast<size_t>(turn_), scriptedActions_);
+        playTurn<QuietLog>();
+    }
+
+    scripted_ = false;
+    return !scriptDiverged_;
+}
+
+// Whether the game ended while replaying
+bool GM_209277367_322542887::isGameOver() const {
+    return gameOver_;
+}
+
+/**
+ * @brief Saves the engine state between two turns.
+ *
+ * Copies the board, the tank and shell arrays, the counters, the turn and the
+ * result of a decided game into @p out. Reusing the same snapshot makes this a set of array copies with no
+ * allocations, so a game can be forked at any turn cheaply.
+ *
+ * @param out Snapshot to overwrite.
+ */
+void GM_209277367_322542887::snapshot(GameSnapshot& out) const {
+    out.board = gameboard_;
+    tanks_.save(out.tanks);
+    shells_.save(out.shells);
+
+    out.width = width_, out.height = height_, out.maxSteps = maxSteps_, out.numShells = numShells_;
+    out.turn = turn_;
+    out.gameOver = gameOver_;
+    out.gameOverStatus = gameOverStatus_;
+    out.noAmmoFlag = noAmmoFlag_;
+    out.noAmmoTimer = noAmmoTimer_;
+    out.numTanks1 = numTanks1_;
+    out.numTanks2 = numTanks2_;
+
+    out.hasResult = hasResult_;
+    out.winner = hasResult_ ? gameResult_.winner : 0;
+    out.reason = hasResult_ ? static_cast<int>(gameResult_.reason) : 0;
+    out.remainingTanks.clear();
+    if (hasResult_) { out.remainingTanks.assign(gameResult_.remaining_tanks.begin(), gameResult_.remaining_tanks.end()); }
+    out.rounds = hasResult_ ? gameResult_.rounds : 0;
+}
+
+/**
+ * @brief Continues from a state saved with snapshot().
+ *
+ * Works on this or any other GameManager instance. The restored game has no
+ * players: tank algorithms are kept only for tanks that match the current
+ * ones, and later turns are driven with stepWithActions().
+ *
+ * @param in Snapshot to load.
+ */
+void GM_209277367_322542887::restore(const GameSnapshot& in) {
+    const bool same_size = (in.width == width_ && in.height == height_ &&
+        neighbors_.size() == static_cast<size_t>(in.width) * in.height * 8);
+    width_ = in.width, height_ = in.height, maxSteps_ = in.maxSteps, numShells_ = in.numShells;
+    player1_ = nullptr, player2_ = nullptr;
+    const size_t num_cells = static_cast<size_t>(width_) * height_;
+
+    gameboard_ = in.board;
+    if (!same_size) { buildNeighborTable(); }
+    tanks_.load(in.tanks);
+    shells_.load(in.shells);
+    if (options_.shellEngine != ShellEngine::Stepwise && shellTargets_.size() != num_cells) { shellTargets_.assign(num_cells, 0); }
+    setupBands();
+
+    lastRoundGameboard_.assign(gameboard_.begin(), gameboard_.end());
+    staleCell_.assign(num_cells, 0);
+    staleCells_.clear();
+    undoLog_.clear();
+    rehashBoard();
+
+    turn_ = in.turn;
+    gameOver_ = in.gameOver;
+    gameOverStatus_ = in.gameOverStatus;
+    noAmmoFlag_ = in.noAmmoFlag;
+    noAmmoTimer_ = in.noAmmoTimer;
+    numTanks1_ = in.numTanks1;
+    numTanks2_ = in.numTanks2;
+    gameResult_ = GameResult{};
+    hasResult_ = false;
+    if (in.hasResult) { updateGameResult(in.winner, in.reason, in.remainingTanks, in.rounds); } // result() attaches the restored board
+    seenStates_.clear(); // States of the abandoned timeline
+    cycleCheckTurn_ = -1;
+    skipCycles_ = options_.cycleDetection && !verbose_ && allAlgorithmsStateless(); // Every turn needs its log line
+}
+
+/**
+ * @brief Plays one turn with the given tank actions instead of the algorithms.
+ *
+ * Actions that are not valid for a tank are ignored exactly as in a real game.
+ *
+ * @param actions One action per tank, in tank index order.
+ * @return false if the game is already over or @p actions has the wrong size.
+ */
+bool GM_209277367_322542887::stepWithActions(const vector<ActionRequest>& actions) {
+    if (gameOver_ || actions.size() != tanks_.size()) { return false; }
+
+    scriptedActions_.clear();
+    for (const ActionRequest action : actions) { scriptedActions_.emplace_back(action, true); }
+
+    scripted_ = true;
+    playTurn<QuietLog>();
+    scripted_ = false;
+    return true;
+}
+
+// Recompute boardHash_ from scratch after the whole board was replaced
+void GM_209277367_322542887::rehashBoard() {
+    boardHash_ = 0;
+    for (size_t cell = 0; cell < gameboard_.size(); ++cell) {
+        boardHash_ ^= zobristKey(ZobristFeature::BoardCell, cell, static_cast<uint8_t>(gameboard_[cell]));
+    }
+}
+
+/**
+ * @brief Zobrist hash of the state between two turns.
+ *
+ * Covers the board, every tank's state, the shells in flight and the no-ammo
+ * flag, but not the turn number, so equal hashes at different turns mean the
+ * game has entered a cycle. The board part is maintained incrementally; tanks
+ * and shells are folded in on each call. Keys come from zobristKey(), so
+ * external tools can recompute the same value.
+ *
+ * @return 64-bit state hash.
+ */
+uint64_t GM_209277367_322542887::getStateHash() const {
+    uint64_t hash = boardHash_ ^ tanks_.hash() ^ shells_.hash();
+    if (noAmmoFlag_) { hash ^= zobristKey(ZobristFeature::NoAmmo, 0, 1); }
+    return hash;
+}
+
+/**
+ * @brief Skips whole state cycles once the state at a turn boundary repeats.
+ *
+ * The hash seen at turn @c t0 is back at @c turn_, which suggests the game
+ * loops with period @c turn_ - @c t0. A hash match is not proof, so the
+ * state is saved and compared in full one period later. Only when it is
+ * unchanged is the cycle real: @c turn_ then advances by every whole period
+ * that still fits, which leaves the game in the very state it would have had,
+ * and the remaining turns (fewer than one period) are played normally.
+ * Nothing is skipped while the no-ammo timer could still end the game first,
+ * since the timer is not part of the state. A hash recorded at this turn or
+ * later (left from another timeline) is only re-recorded.
+ */
+void GM_209277367_322542887::skipCycles() {
+    if (cycleCheckTurn_ >= 0) { // A repeated hash waits for its full-state check
+        if (turn_ < cycleCheckTurn_) { return; }
+        cycleCheckTurn_ = -1;
+        snapshot(cycleEnd_);
+        seenStates_.clear(); // Recorded turns are either skipped past or from a false match
+        if (!sameCycleState(cycleStart_, cycleEnd_)) { return; } // Hash collision
+
+        const int remaining = maxSteps_ - turn_;
+        if (noAmmoFlag_ && noAmmoTimer_ <= static_cast<size_t>(remaining)) { return; }
+
+        const int skipped = (remaining / cyclePeriod_) * cyclePeriod_;
+        turn_ += skipped;
+        if (noAmmoFlag_) { noAmmoTimer_ -= static_cast<size_t>(skipped); }
+        return;
+    }
+
+    const auto [seen, inserted] = seenStates_.try_emplace(getStateHash(), turn_);
+    if (inserted) { return; }
+    if (seen->second >= turn_) { seen->second = turn_; return; } // Not a cycle of this timeline
+
+    cyclePeriod_ = turn_ - seen->second; // Positive
+    cycleCheckTurn_ = turn_ + cyclePeriod_;
+    snapshot(cycleStart_);
+}
@@ -0,0 +1,91 @@
+# include "GameArena.h"
+
+#include <algorithm>
+#include <thread>
+
+// Allocation from the pool, counted
+void* GameArena::TrackingResource::do_allocate(const size_t bytes, const size_t alignment) {
+    void* p = arena_.pool_->allocate(bytes, alignment);
+    this->bytes += bytes;
+    return p;
+}
+
+void GameArena::TrackingResource::do_deallocate(void* p, const size_t bytes, const size_t alignment) {
+    this->bytes -= bytes;
+    arena_.pool_->deallocate(p, bytes, alignment);
+}
+
+// Heap allocation the monotonic buffer could not serve
+void* GameArena::OverflowResource::do_allocate(const size_t bytes, const size_t alignment) {
+    this->bytes += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+}
+
+void GameArena::OverflowResource::do_deallocate(void* p, const size_t bytes, const size_t alignment) {
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+}
+
+// Constructor, starts with no retained buffer
+GameArena::GameArena() {
+    rebuild();
+}
+
+// Arena of the calling thread, shared by its leases and created anew once they are all gone.
+// The registry only holds weak references, so nothing outlives the thread's last game manager.
+shared_ptr<GameArena> GameArena::forThisThread() {
+    static std::mutex registryMutex;
+    static std::unordered_map<std::thread::id, std::weak_ptr<GameArena>> registry;
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+    std::weak_ptr<GameArena>& entry = registry[std::this_thread::get_id()];
+    shared_ptr<GameArena> arena = entry.lock();
+    if (arena) { return arena; }
+
+    std::erase_if(registry, [](const auto& item) { return item.second.expired(); }); // Threads that are done
+    arena = std::make_shared<GameArena>();
+    registry[std::this_thread::get_id()] = arena;
+    return arena;
+}
+
+// Fresh resources over buffer_ (the old ones must hold no live allocation)
+void GameArena::rebuild() {
+    pool_.reset();
+    monotonic_.reset();
+    overflow_.bytes = 0;
+    monotonic_.emplace(buffer_.data(), buffer_.size(), &overflow_);
+    pool_.emplace(&*monotonic_);
+}
+
+// A game starts using the arena
+std::pmr::memory_resource* GameArena::acquire() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++users_;
+    return &tracker_;
+}
+
+// A game let go; the last one drops the arena, if nothing allocated from it is alive, and keeps the buffer grown to this peak
+void GameArena::release() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (--users_ != 0 || tracker_.bytes != 0) { return; }
+
+    ++resets_;
+    const size_t peak = buffer_.size() + overflow_.bytes;
+    pool_.reset();
+    monotonic_.reset(); // Frees the overflow chunks
+    if (peak > buffer_.size() && peak <= kMaxRetainedBytes) { buffer_.resize(peak); }
+    rebuild();
+}
+
+// Constructor, takes the calling thread's arena
+GameArena::Lease::Lease() : arena_(GameArena::forThisThread()), resource_(arena_->acquire()) {}
+
+// Destructor, the last lease of an arena resets it
+GameArena::Lease::~Lease() {
+    arena_->release();
+}
+
+// Let go of the arena and take it again; call it once the containers it fed are freed
+void GameArena::Lease::renew() {
+    arena_->release();
+    resource_ = arena_->acquire();
+}
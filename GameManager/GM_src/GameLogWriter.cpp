@@ -0,0 +1,57 @@
+# include "GameLogWriter.h"
+
+#include <charconv>
+
+// Open (and truncate) the log file
+bool GameLogWriter::open(const string& path) {
+    close();
+    buffer_.clear();
+    buffer_.reserve(kChunkSize * 2);
+    file_.open(path, std::ios::out | std::ios::trunc);
+    return file_.is_open();
+}
+
+// Write the buffer to the file
+void GameLogWriter::flush() {
+    if (!file_.is_open()) { return; }
+    if (!buffer_.empty()) {
+        file_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+        buffer_.clear();
+    }
+    file_.flush();
+}
+
+// Flush and close the file
+void GameLogWriter::close() {
+    if (!file_.is_open()) { return; }
+    flush();
+    file_.close();
+}
+
+// Append text
+GameLogWriter& GameLogWriter::operator<<(const string_view text) {
+    buffer_.append(text);
+    flushIfFull();
+    return *this;
+}
+
+// Append one character
+GameLogWriter& GameLogWriter::operator<<(const char c) {
+    buffer_.push_back(c);
+    flushIfFull();
+    return *this;
+}
+
+// Append a decimal number
+GameLogWriter& GameLogWriter::operator<<(const int value) {
+    char digits[16];
+    const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    return *this << string_view(digits, static_cast<size_t>(result.ptr - digits));
+}
+
+// Append a decimal number
+GameLogWriter& GameLogWriter::operator<<(const size_t value) {
+    char digits[24];
+    const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+    return *this << string_view(digits, static_cast<size_t>(result.ptr - digits));
+}
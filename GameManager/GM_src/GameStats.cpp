@@ -0,0 +1,32 @@
+# include "GameStats.h"
+
+#include <fstream>
+
+// Name of the engine function behind a phase
+string_view phaseName(const GamePhase phase) {
+    static constexpr string_view names[GameStats::kPhases] = {
+        "getTankActions", "performTankActions", "moveShells", "checkShellsCollide", "updateGameLog", "checkTanksStatus"
+    };
+    return names[static_cast<size_t>(phase)];
+}
+
+// Write the figures as "key value" lines, times in nanoseconds
+bool GameStats::write(const string& path) const {
+    std::ofstream file(path, std::ios::out | std::ios::trunc);
+    if (!file) { return false; }
+
+    uint64_t total = 0;
+    for (const uint64_t nanos : phaseNanos) { total += nanos; }
+
+    file << "turns " << turns << '\n'
+         << "tank_turns " << tankTurns << '\n'
+         << "shell_turns " << shellTurns << '\n'
+         << "max_shells " << maxShells << '\n'
+         << "battle_info_requests " << battleInfoRequests << '\n';
+    for (size_t i = 0; i < kPhases; ++i) {
+        file << "ns_" << phaseName(static_cast<GamePhase>(i)) << ' ' << phaseNanos[i] << '\n';
+    }
+    file << "ns_battle_info_callbacks " << battleInfoNanos << '\n'
+         << "ns_total " << total << '\n';
+    return static_cast<bool>(file);
+}
@@ -0,0 +1,309 @@
+# include "Replay.h"
+
+#include <iterator>
+
+namespace {
+    constexpr char kMagic[4] = {'T', 'K', 'R', 'P'};
+    constexpr uint64_t kVersion = 1;
+    constexpr char kKeyframeTag = 'K';
+    constexpr char kTurnTag = 'T';
+    constexpr char kEndTag = 'E';
+    constexpr uint8_t kIgnoredBit = 0x10; // Set in an encoded action when the action was ignored
+    constexpr uint8_t kNoAction = 0xFF; // Baseline that differs from every encoded action
+
+    // Append an unsigned varint (7 bits per byte, low bits first)
+    void putVarint(string& out, uint64_t value) {
+        while (value >= 0x80) {
+            out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<char>(value));
+    }
+
+    // Append a signed varint (zigzag encoded, so small negatives stay short)
+    void putSigned(string& out, const int64_t value) {
+        putVarint(out, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+    }
+
+    // Bounds-checked reader over a loaded replay
+    struct Cursor {
+        const string& data;
+        size_t pos = 0;
+        bool ok = true;
+
+        bool atEnd() const { return pos >= data.size(); }
+
+        uint8_t byte() {
+            if (atEnd()) { ok = false; return 0; }
+            return static_cast<uint8_t>(data[pos++]);
+        }
+
+        uint64_t varint() {
+            uint64_t value = 0;
+            for (int shift = 0; shift < 64; shift += 7) {
+                const uint8_t b = byte();
+                if (!ok) { return 0; }
+                value |= static_cast<uint64_t>(b & 0x7F) << shift;
+                if ((b & 0x80) == 0) { return value; }
+            }
+            ok = false;
+            return 0;
+        }
+
+        int64_t signedVarint() {
+            const uint64_t v = varint();
+            return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1);
+        }
+    };
+
+    uint8_t encodeAction(const pair<ActionRequest, bool>& action) {
+        return static_cast<uint8_t>(static_cast<uint8_t>(action.first) | (action.second ? 0 : kIgnoredBit));
+    }
+}
+
+// 64-bit FNV-1a over the board size and cells
+uint64_t fingerprintMap(const size_t width, const size_t height, const vector<char>& board) {
+    uint64_t hash = 14695981039346656037ULL;
+    auto mix = [&hash](const uint64_t byte) { hash = (hash ^ byte) * 1099511628211ULL; };
+
+    for (int shift = 0; shift < 64; shift += 8) { mix((width >> shift) & 0xFF); }
+    for (int shift = 0; shift < 64; shift += 8) { mix((height >> shift) & 0xFF); }
+    for (const char cell : board) { mix(static_cast<uint8_t>(cell)); }
+    return hash;
+}
+
+// Create the file and write the header
+bool ReplayWriter::open(const string& path, const ReplayHeader& header) {
+    close();
+    buffer_.clear();
+    turns_ = 0;
+    lastActions_.assign(header.numTanks, kNoAction);
+
+    file_.open(path, std::ios::out | std::ios::trunc | std::ios::binary);
+    if (!file_.is_open()) { return false; }
+
+    buffer_.append(kMagic, sizeof(kMagic));
+    putVarint(buffer_, kVersion);
+    putVarint(buffer_, header.width);
+    putVarint(buffer_, header.height);
+    putVarint(buffer_, header.maxSteps);
+    putVarint(buffer_, header.numShells);
+    putVarint(buffer_, header.keyframeInterval);
+    putVarint(buffer_, header.numTanks);
+    for (int shift = 0; shift < 64; shift += 8) {
+        buffer_.push_back(static_cast<char>((header.mapFingerprint >> shift) & 0xFF));
+    }
+    return true;
+}
+
+// Record the state at the start of a turn
+void ReplayWriter::writeKeyframe(const ReplayKeyframe& keyframe) {
+    if (!file_.is_open()) { return; }
+
+    buffer_.push_back(kKeyframeTag);
+    putVarint(buffer_, keyframe.turn);
+
+    // Board as (run length, cell) pairs
+    for (size_t i = 0; i < keyframe.board.size();) {
+        size_t run = 1;
+        while (i + run < keyframe.board.size() && keyframe.board[i + run] == keyframe.board[i]) { ++run; }
+        putVarint(buffer_, run);
+        buffer_.push_back(keyframe.board[i]);
+        i += run;
+    }
+
+    for (const TankState& tank : keyframe.tanks) {
+        putVarint(buffer_, static_cast<uint64_t>(tank.id));
+        putVarint(buffer_, static_cast<uint64_t>(tank.playerId));
+        putSigned(buffer_, tank.cell);
+        buffer_.push_back(static_cast<char>(static_cast<uint8_t>(tank.dir) |
+            (tank.backwardsFlag ? 0x10 : 0) | (tank.justMovedBackwards ? 0x20 : 0)));
+        putSigned(buffer_, tank.ammo);
+        putSigned(buffer_, tank.turnsToShoot);
+        putSigned(buffer_, tank.turnsToBackwards);
+        putSigned(buffer_, tank.turnsDead);
+    }
+
+    // Shells in slot order, cells as deltas from the previous shell
+    putVarint(buffer_, keyframe.shells.size());
+    int prev_cell = 0;
+    for (const ShellState& shell : keyframe.shells) {
+        putSigned(buffer_, shell.cell - prev_cell);
+        buffer_.push_back(static_cast<char>(static_cast<uint8_t>(shell.dir) | (shell.aboveMine ? 0x10 : 0)));
+        prev_cell = shell.cell;
+    }
+
+    buffer_.push_back(static_cast<char>(keyframe.noAmmoFlag));
+    putVarint(buffer_, keyframe.noAmmoTimer);
+    putVarint(buffer_, keyframe.numTanks1);
+    putVarint(buffer_, keyframe.numTanks2);
+
+    std::fill(lastActions_.begin(), lastActions_.end(), kNoAction); // Each keyframe starts a new delta chain
+    flushIfFull();
+}
+
+// Record a turn's actions and ignore flags, only for tanks whose pair changed
+void ReplayWriter::writeTurn(const std::span<const pair<ActionRequest, bool>> actions) {
+    if (!file_.is_open()) { return; }
+
+    size_t changed = 0;
+    for (size_t i = 0; i < actions.size(); ++i) {
+        if (encodeAction(actions[i]) != lastActions_[i]) { ++changed; }
+    }
+
+    buffer_.push_back(kTurnTag);
+    putVarint(buffer_, changed);
+    size_t next = 0;
+    for (size_t i = 0; i < actions.size(); ++i) {
+        const uint8_t encoded = encodeAction(actions[i]);
+        if (encoded == lastActions_[i]) { continue; }
+        putVarint(buffer_, i - next); // Gap from the previous changed tank
+        buffer_.push_back(static_cast<char>(encoded));
+        lastActions_[i] = encoded;
+        next = i + 1;
+    }
+
+    ++turns_;
+    flushIfFull();
+}
+
+// Write the end marker and close the file
+void ReplayWriter::close() {
+    if (!file_.is_open()) { return; }
+
+    buffer_.push_back(kEndTag);
+    putVarint(buffer_, turns_);
+    file_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+    buffer_.clear();
+    file_.close();
+}
+
+// Write out a full chunk
+void ReplayWriter::flushIfFull() {
+    if (buffer_.size() < kChunkSize) { return; }
+    file_.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+    buffer_.clear();
+}
+
+// Read and decode a replay file
+bool ReplayReader::load(const string& path, string& error) {
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    if (!file.is_open()) { error = "Cannot open replay file: " + path; return false; }
+    const string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    header_ = ReplayHeader{};
+    keyframes_.clear();
+    turns_.clear();
+
+    Cursor in{data};
+    if (data.size() < sizeof(kMagic) || data.compare(0, sizeof(kMagic), kMagic, sizeof(kMagic)) != 0) {
+        error = "Not a replay file: " + path;
+        return false;
+    }
+    in.pos = sizeof(kMagic);
+    if (in.varint() != kVersion) { error = "Unsupported replay version"; return false; }
+
+    header_.width = in.varint();
+    header_.height = in.varint();
+    header_.maxSteps = in.varint();
+    header_.numShells = in.varint();
+    header_.keyframeInterval = in.varint();
+    header_.numTanks = in.varint();
+    for (int shift = 0; shift < 64; shift += 8) {
+        header_.mapFingerprint |= static_cast<uint64_t>(in.byte()) << shift;
+    }
+
+    const size_t num_cells = header_.width * header_.height;
+    vector<uint8_t> actions(header_.numTanks, kNoAction);
+    bool ended = false;
+
+    while (in.ok && !ended && !in.atEnd()) {
+        const char tag = static_cast<char>(in.byte());
+
+        if (tag == kKeyframeTag) {
+            ReplayKeyframe keyframe;
+            keyframe.turn = in.varint();
+            if (keyframe.turn != turns_.size()) { in.ok = false; break; }
+
+            keyframe.board.reserve(num_cells);
+            while (in.ok && keyframe.board.size() < num_cells) {
+                const size_t run = in.varint();
+                const char cell = static_cast<char>(in.byte());
+                if (run == 0 || keyframe.board.size() + run > num_cells) { in.ok = false; break; }
+                keyframe.board.insert(keyframe.board.end(), run, cell);
+            }
+
+            keyframe.tanks.resize(header_.numTanks);
+            for (TankState& tank : keyframe.tanks) {
+                tank.id = static_cast<int>(in.varint());
+                tank.playerId = static_cast<int>(in.varint());
+                tank.cell = static_cast<int>(in.signedVarint());
+                const uint8_t dir = in.byte();
+                tank.dir = static_cast<Direction>(dir & 0x0F);
+                tank.backwardsFlag = (dir & 0x10) != 0;
+                tank.justMovedBackwards = (dir & 0x20) != 0;
+                tank.ammo = static_cast<int>(in.signedVarint());
+                tank.turnsToShoot = static_cast<int>(in.signedVarint());
+                tank.turnsToBackwards = static_cast<int>(in.signedVarint());
+                tank.turnsDead = static_cast<int>(in.signedVarint());
+                if (tank.playerId < 1 || tank.playerId > 2) { in.ok = false; }
+            }
+
+            const size_t num_shells = in.varint();
+            if (num_shells > num_cells * 2) { in.ok = false; break; }
+            keyframe.shells.resize(num_shells);
+            int prev_cell = 0;
+            for (ShellState& shell : keyframe.shells) {
+                shell.cell = prev_cell + static_cast<int>(in.signedVarint());
+                const uint8_t dir = in.byte();
+                shell.dir = static_cast<Direction>(dir & 0x0F);
+                shell.aboveMine = (dir & 0x10) != 0;
+                prev_cell = shell.cell;
+            }
+
+            keyframe.noAmmoFlag = in.byte() != 0;
+            keyframe.noAmmoTimer = in.varint();
+            keyframe.numTanks1 = in.varint();
+            keyframe.numTanks2 = in.varint();
+
+            keyframes_.push_back(std::move(keyframe));
+            std::fill(actions.begin(), actions.end(), kNoAction);
+        } else if (tag == kTurnTag) {
+            if (keyframes_.empty()) { in.ok = false; break; }
+            const size_t changed = in.varint();
+            size_t next = 0;
+            for (size_t c = 0; in.ok && c < changed; ++c) {
+                const size_t i = next + in.varint();
+                const uint8_t encoded = in.byte();
+                if (i >= actions.size()) { in.ok = false; break; }
+                actions[i] = encoded;
+                next = i + 1;
+            }
+            turns_.push_back(actions);
+        } else if (tag == kEndTag) {
+            ended = in.varint() == turns_.size();
+            if (!ended) { in.ok = false; }
+        } else {
+            in.ok = false;
+        }
+    }
+
+    if (!in.ok || keyframes_.empty()) { error = "Corrupt replay file: " + path; return false; }
+    if (!ended) { error = "Truncated replay file: " + path; return false; }
+    return true;
+}
+
+// Latest keyframe at or before a turn
+const ReplayKeyframe& ReplayReader::getKeyframeFor(const size_t turn) const {
+    size_t k = 0;
+    while (k + 1 < keyframes_.size() && keyframes_[k + 1].turn <= turn) { ++k; }
+    return keyframes_[k];
+}
+
+// Actions and ignore flags of a turn
+void ReplayReader::getActions(const size_t turn, vector<pair<ActionRequest, bool>>& actions) const {
+    actions.clear();
+    for (const uint8_t encoded : turns_[turn]) {
+        actions.emplace_back(static_cast<ActionRequest>(encoded & 0x0F), (encoded & kIgnoredBit) == 0);
+    }
+}
@@ -0,0 +1,200 @@
+# include "ShellPool.h"
+
+#include <algorithm>
+
+// Constructor, every array allocates from resource
+ShellPool::ShellPool(std::pmr::memory_resource* resource)
+    : cell_(resource), dir_(resource), aboveMine_(resource), alive_(resource), nextInCell_(resource), head_(resource),
+      order_(resource), scratchCell_(resource), scratchDir_(resource), scratchAboveMine_(resource) {}
+
+// Remove all shells and size the cell chains and the buckets of collapseStacked()
+void ShellPool::reset(const int width, const int height) {
+    const size_t num_cells = static_cast<size_t>(width) * height;
+    cell_.clear();
+    dir_.clear();
+    aboveMine_.clear();
+    alive_.clear();
+    nextInCell_.clear();
+    head_.assign(num_cells, -1);
+    bucketStart_.assign(static_cast<size_t>(std::max(width, height)) + 1, 0);
+    aliveCount_ = 0;
+}
+
+// Remove all shells and hand every array's memory back to the resource
+void ShellPool::release() {
+    freeArenaMemory(cell_);
+    freeArenaMemory(dir_);
+    freeArenaMemory(aboveMine_);
+    freeArenaMemory(alive_);
+    freeArenaMemory(nextInCell_);
+    freeArenaMemory(head_);
+    freeArenaMemory(order_);
+    freeArenaMemory(sorted_);
+    freeArenaMemory(bucketStart_);
+    freeArenaMemory(scratchCell_);
+    freeArenaMemory(scratchDir_);
+    freeArenaMemory(scratchAboveMine_);
+    aliveCount_ = 0;
+}
+
+// Room for this many slots in every array, scratch buffers included
+void ShellPool::reserve(const size_t shells) {
+    cell_.reserve(shells);
+    dir_.reserve(shells);
+    aboveMine_.reserve(shells);
+    alive_.reserve(shells);
+    nextInCell_.reserve(shells);
+    order_.reserve(shells);
+    sorted_.reserve(shells);
+    scratchCell_.reserve(shells);
+    scratchDir_.reserve(shells);
+    scratchAboveMine_.reserve(shells);
+}
+
+// Append a shell at the end of the processing order
+size_t ShellPool::add(const int cell, const Direction dir, const bool above_mine) {
+    const size_t slot = cell_.size();
+
+    cell_.push_back(cell);
+    dir_.push_back(dir);
+    aboveMine_.push_back(above_mine);
+    alive_.push_back(true);
+    nextInCell_.push_back(-1);
+    link(slot);
+    ++aliveCount_;
+
+    return slot;
+}
+
+// Tombstone a shell
+void ShellPool::remove(const size_t slot) {
+    if (!alive_[slot]) { return; }
+
+    unlink(slot);
+    alive_[slot] = false;
+    --aliveCount_;
+}
+
+// Get the first shell at a cell in processing order
+int ShellPool::getShellAt(const int cell) const {
+    int first = -1;
+    for (int s = head_[cell]; s != -1; s = nextInCell_[s]) {
+        if (first == -1 || s < first) { first = s; }
+    }
+
+    return first;
+}
+
+// Count the shells at a cell
+size_t ShellPool::countAt(const int cell) const {
+    size_t count = 0;
+    for (int s = head_[cell]; s != -1; s = nextInCell_[s]) { ++count; }
+
+    return count;
+}
+
+// Move a shell to a new cell
+void ShellPool::setCell(const size_t slot, const int cell) {
+    if (cell_[slot] == cell) { return; }
+
+    unlink(slot);
+    cell_[slot] = cell;
+    link(slot);
+}
+
+// Push slot onto its cell's chain
+void ShellPool::link(const size_t slot) {
+    nextInCell_[slot] = head_[cell_[slot]];
+    head_[cell_[slot]] = static_cast<int>(slot);
+}
+
+// Remove slot from its cell's chain
+void ShellPool::unlink(const size_t slot) {
+    int* prev = &head_[cell_[slot]];
+    while (*prev != static_cast<int>(slot)) { prev = &nextInCell_[*prev]; }
+
+    *prev = nextInCell_[slot];
+    nextInCell_[slot] = -1;
+}
+
+// Stable counting sort of the slots in from into to, by a key below buckets
+template <typename Key>
+void ShellPool::bucketSort(const ArenaVector<int>& from, ArenaVector<int>& to, const size_t buckets, const Key key) {
+    bucketStart_.assign(buckets + 1, 0);
+    for (const int s : from) { ++bucketStart_[key(s) + 1]; }
+    for (size_t b = 1; b <= buckets; ++b) { bucketStart_[b] += bucketStart_[b - 1]; }
+
+    to.resize(from.size());
+    for (const int s : from) { to[bucketStart_[key(s)]++] = s; }
+}
+
+// Drop stacked shells and tombstones, keep the rest sorted by (x, y)
+void ShellPool::collapseStacked(const int width, const int height) {
+    order_.clear();
+
+    for (size_t s = 0; s < cell_.size(); ++s) {
+        if (!alive_[s]) { continue; }
+        if (countAt(cell_[s]) == 1) { order_.push_back(static_cast<int>(s)); }
+    }
+
+    for (size_t s = 0; s < cell_.size(); ++s) { // Every chain is rebuilt below
+        if (alive_[s]) { head_[cell_[s]] = -1; }
+    }
+
+    // Survivors sit on distinct cells: sort by row, then stably by column, in O(shells + width + height)
+    bucketSort(order_, sorted_, static_cast<size_t>(height), [&](const int s) { return static_cast<size_t>(cell_[s] / width); });
+    bucketSort(sorted_, order_, static_cast<size_t>(width), [&](const int s) { return static_cast<size_t>(cell_[s] % width); });
+
+    scratchCell_.clear();
+    scratchDir_.clear();
+    scratchAboveMine_.clear();
+    for (const int s : order_) {
+        scratchCell_.push_back(cell_[s]);
+        scratchDir_.push_back(dir_[s]);
+        scratchAboveMine_.push_back(aboveMine_[s]);
+    }
+
+    cell_.swap(scratchCell_);
+    dir_.swap(scratchDir_);
+    aboveMine_.swap(scratchAboveMine_);
+    alive_.assign(cell_.size(), true);
+    nextInCell_.assign(cell_.size(), -1);
+    aliveCount_ = cell_.size();
+
+    for (size_t s = 0; s < cell_.size(); ++s) {
+        head_[cell_[s]] = static_cast<int>(s);
+    }
+}
+
+// Zobrist hash of the shells in flight; XOR makes it independent of slot order
+uint64_t ShellPool::hash() const {
+    uint64_t h = 0;
+    for (size_t slot = 0; slot < cell_.size(); ++slot) {
+        if (!alive_[slot]) { continue; }
+        h ^= zobristKey(ZobristFeature::Shell, static_cast<uint64_t>(cell_[slot]),
+            static_cast<uint64_t>(dir_[slot]) | (static_cast<uint64_t>(aboveMine_[slot]) << 3));
+    }
+    return h;
+}
+
+// Copy the pool into a snapshot, reusing its buffers
+void ShellPool::save(Snapshot& out) const {
+    out.cell = cell_;
+    out.dir = dir_;
+    out.aboveMine = aboveMine_;
+    out.alive = alive_;
+    out.nextInCell = nextInCell_;
+    out.head = head_;
+    out.aliveCount = aliveCount_;
+}
+
+// Replace the pool with a snapshot
+void ShellPool::load(const Snapshot& in) {
+    cell_ = in.cell;
+    dir_ = in.dir;
+    aboveMine_ = in.aboveMine;
+    alive_ = in.alive;
+    nextInCell_ = in.nextInCell;
+    head_ = in.head;
+    aliveCount_ = in.aliveCount;
+}
@@ -0,0 +1,244 @@
+# include "TankRegistry.h"
+
+#include <utility>
+
+// Constructor, every array allocates from resource
+TankRegistry::TankRegistry(std::pmr::memory_resource* resource)
+    : info_(resource), cell_(resource), dir_(resource), ammo_(resource), playerId_(resource), turnsToShoot_(resource),
+      turnsToBackwards_(resource), backwardsFlag_(resource), justMovedBackwards_(resource), turnsDead_(resource),
+      newlyDestroyed_(resource), grid_(resource), occupancy_(resource) {}
+
+// Remove all tanks and size the position grid
+void TankRegistry::reset(const size_t num_cells) {
+    info_.clear();
+    cell_.clear();
+    dir_.clear();
+    ammo_.clear();
+    playerId_.clear();
+    turnsToShoot_.clear();
+    turnsToBackwards_.clear();
+    backwardsFlag_.clear();
+    justMovedBackwards_.clear();
+    turnsDead_.clear();
+    newlyDestroyed_.clear();
+
+    grid_.assign(num_cells, -1);
+    occupancy_.assign(num_cells, 0);
+
+    for (int p = 0; p < 3; ++p) {
+        alive_[p] = 0;
+        noAmmo_[p] = 0;
+    }
+}
+
+// Remove all tanks and hand every array's memory back to the resource
+void TankRegistry::release() {
+    freeArenaMemory(info_);
+    freeArenaMemory(cell_);
+    freeArenaMemory(dir_);
+    freeArenaMemory(ammo_);
+    freeArenaMemory(playerId_);
+    freeArenaMemory(turnsToShoot_);
+    freeArenaMemory(turnsToBackwards_);
+    freeArenaMemory(backwardsFlag_);
+    freeArenaMemory(justMovedBackwards_);
+    freeArenaMemory(turnsDead_);
+    freeArenaMemory(newlyDestroyed_);
+    freeArenaMemory(grid_);
+    freeArenaMemory(occupancy_);
+
+    for (int p = 0; p < 3; ++p) {
+        alive_[p] = 0;
+        noAmmo_[p] = 0;
+    }
+}
+
+// Add a tank at a cell, tanks orientation dependant on players id
+size_t TankRegistry::addTank(const int id, const int cell, const int ammo, const int player_id, unique_ptr<TankAlgorithm> tank) {
+    const size_t i = info_.size();
+
+    info_.emplace_back(id, player_id, std::move(tank));
+    cell_.push_back(-1);
+    dir_.push_back(player_id == 1 ? Direction::L : Direction::R);
+    ammo_.push_back(ammo);
+    playerId_.push_back(player_id);
+    turnsToShoot_.push_back(0);
+    turnsToBackwards_.push_back(2);
+    backwardsFlag_.push_back(false);
+    justMovedBackwards_.push_back(false);
+    turnsDead_.push_back(0);
+
+    ++alive_[player_id];
+    if (ammo <= 0) { ++noAmmo_[player_id]; }
+
+    setCell(i, cell);
+    return i;
+}
+
+// Add a tank in a previously saved state
+size_t TankRegistry::restoreTank(const TankState& state, unique_ptr<TankAlgorithm> tank) {
+    const size_t i = info_.size();
+
+    info_.emplace_back(state.id, state.playerId, std::move(tank));
+    cell_.push_back(-1);
+    dir_.push_back(state.dir);
+    ammo_.push_back(state.ammo);
+    playerId_.push_back(state.playerId);
+    turnsToShoot_.push_back(state.turnsToShoot);
+    turnsToBackwards_.push_back(state.turnsToBackwards);
+    backwardsFlag_.push_back(state.backwardsFlag);
+    justMovedBackwards_.push_back(state.justMovedBackwards);
+    turnsDead_.push_back(state.turnsDead);
+
+    if (state.turnsDead == 0) {
+        ++alive_[state.playerId];
+        if (state.ammo <= 0) { ++noAmmo_[state.playerId]; }
+        setCell(i, state.cell);
+    }
+    return i;
+}
+
+// Get every per-tank field
+TankState TankRegistry::getState(const size_t i) const {
+    TankState state;
+    state.id = info_[i].getID();
+    state.playerId = playerId_[i];
+    state.cell = cell_[i];
+    state.dir = dir_[i];
+    state.ammo = ammo_[i];
+    state.turnsToShoot = turnsToShoot_[i];
+    state.turnsToBackwards = turnsToBackwards_[i];
+    state.backwardsFlag = backwardsFlag_[i];
+    state.justMovedBackwards = justMovedBackwards_[i];
+    state.turnsDead = turnsDead_[i];
+    return state;
+}
+
+// Get the lowest alive tank index at a cell
+int TankRegistry::getTankIndexAt(const int cell) const {
+    if (cell < 0) { return -1; }
+    return grid_[cell];
+}
+
+// Move a tank to a new cell
+void TankRegistry::setCell(const size_t i, const int cell) {
+    removeFromGrid(i);
+    cell_[i] = cell;
+
+    if (cell < 0) { return; }
+    ++occupancy_[cell];
+    if (grid_[cell] == -1 || static_cast<int>(i) < grid_[cell]) { grid_[cell] = static_cast<int>(i); }
+}
+
+// Release the tank's grid cell
+void TankRegistry::removeFromGrid(const size_t i) {
+    const int cell = cell_[i];
+    if (cell < 0) { return; }
+
+    if (--occupancy_[cell] == 0) {
+        grid_[cell] = -1;
+    } else if (grid_[cell] == static_cast<int>(i)) { // Another tank shares the cell, find the next lowest index
+        grid_[cell] = -1;
+        for (size_t j = i + 1; j < cell_.size(); ++j) {
+            if (cell_[j] == cell) {
+                grid_[cell] = static_cast<int>(j);
+                break;
+            }
+        }
+    }
+}
+
+// Decrease tanks ammo
+void TankRegistry::decreaseAmmo(const size_t i) {
+    if (ammo_[i] <= 0) { return; }
+    if (--ammo_[i] == 0 && turnsDead_[i] == 0) { ++noAmmo_[playerId_[i]]; }
+}
+
+// Increase turns dead
+void TankRegistry::increaseTurnsDead(const size_t i) {
+    if (turnsDead_[i] == 0) { // Tank is destroyed now
+        --alive_[playerId_[i]];
+        if (ammo_[i] <= 0) { --noAmmo_[playerId_[i]]; }
+        newlyDestroyed_.push_back(i);
+    }
+
+    turnsDead_[i] += 1;
+    setCell(i, -1);
+}
+
+// Move tanks destroyed since the last call past their first dead turn
+void TankRegistry::settleNewlyDestroyed() {
+    for (const size_t i : newlyDestroyed_) {
+        if (turnsDead_[i] == 1) { turnsDead_[i] += 1; }
+    }
+    newlyDestroyed_.clear();
+}
+
+// Zobrist hash of every tank's state
+uint64_t TankRegistry::hash() const {
+    uint64_t h = 0;
+    for (size_t i = 0; i < cell_.size(); ++i) {
+        if (turnsDead_[i] != 0) { // Nothing else about a destroyed tank matters anymore
+            h ^= zobristKey(ZobristFeature::TankDead, i, 1);
+            continue;
+        }
+        h ^= zobristKey(ZobristFeature::TankCell, i, static_cast<uint64_t>(cell_[i]));
+        h ^= zobristKey(ZobristFeature::TankDirection, i, static_cast<uint64_t>(dir_[i]));
+        h ^= zobristKey(ZobristFeature::TankAmmo, i, static_cast<uint64_t>(ammo_[i]));
+        h ^= zobristKey(ZobristFeature::TankTurnsToShoot, i, static_cast<uint64_t>(turnsToShoot_[i]));
+        h ^= zobristKey(ZobristFeature::TankTurnsToBackwards, i, static_cast<uint64_t>(turnsToBackwards_[i]));
+        h ^= zobristKey(ZobristFeature::TankBackwardsFlags, i,
+            static_cast<uint64_t>(backwardsFlag_[i]) | (static_cast<uint64_t>(justMovedBackwards_[i]) << 1));
+    }
+    return h;
+}
+
+// Copy the registry into a snapshot, reusing its buffers
+void TankRegistry::save(Snapshot& out) const {
+    out.id.resize(info_.size());
+    for (size_t i = 0; i < info_.size(); ++i) { out.id[i] = info_[i].getID(); }
+    out.cell = cell_;
+    out.dir = dir_;
+    out.ammo = ammo_;
+    out.playerId = playerId_;
+    out.turnsToShoot = turnsToShoot_;
+    out.turnsToBackwards = turnsToBackwards_;
+    out.backwardsFlag = backwardsFlag_;
+    out.justMovedBackwards = justMovedBackwards_;
+    out.turnsDead = turnsDead_;
+    out.newlyDestroyed = newlyDestroyed_;
+    out.grid = grid_;
+    out.occupancy = occupancy_;
+    for (int p = 0; p < 3; ++p) {
+        out.alive[p] = alive_[p];
+        out.noAmmo[p] = noAmmo_[p];
+    }
+}
+
+// Replace the registry with a snapshot. Tanks whose id and player match keep their algorithm,
+// any other tank gets one without an algorithm.
+void TankRegistry::load(const Snapshot& in) {
+    if (info_.size() > in.id.size()) { info_.erase(info_.begin() + static_cast<ptrdiff_t>(in.id.size()), info_.end()); }
+    for (size_t i = 0; i < in.id.size(); ++i) {
+        if (i == info_.size()) { info_.emplace_back(in.id[i], in.playerId[i], nullptr); }
+        else if (info_[i].getID() != in.id[i] || info_[i].getPlayerId() != in.playerId[i]) {
+            info_[i] = TankInfo(in.id[i], in.playerId[i], nullptr);
+        }
+    }
+    cell_ = in.cell;
+    dir_ = in.dir;
+    ammo_ = in.ammo;
+    playerId_ = in.playerId;
+    turnsToShoot_ = in.turnsToShoot;
+    turnsToBackwards_ = in.turnsToBackwards;
+    backwardsFlag_ = in.backwardsFlag;
+    justMovedBackwards_ = in.justMovedBackwards;
+    turnsDead_ = in.turnsDead;
+    newlyDestroyed_ = in.newlyDestroyed;
+    grid_ = in.grid;
+    occupancy_ = in.occupancy;
+    for (int p = 0; p < 3; ++p) {
+        alive_[p] = in.alive[p];
+        noAmmo_[p] = in.noAmmo[p];
+    }
+}
@@ -0,0 +1,27 @@
+# include "TimeBudget.h"
+
+// Set the limits (0 = none) and clear the totals
+void TimeBudget::reset(const size_t action_budget_ms, const size_t game_budget_ms) {
+    *this = TimeBudget{};
+    actionBudget_ = std::chrono::milliseconds(action_budget_ms);
+    gameBudget_ = std::chrono::milliseconds(game_budget_ms);
+    enabled_ = action_budget_ms > 0 || game_budget_ms > 0;
+}
+
+// Charge a getAction call, true if it went over the per-call budget
+bool TimeBudget::chargeAction(const int player_id, const clock::duration elapsed) {
+    used_[player_id] += elapsed;
+    if (actionBudget_ == clock::duration::zero() || elapsed <= actionBudget_) { return false; }
+    ++overruns_[player_id];
+    return true;
+}
+
+// Charge a battle-info callback; it has already run, so it only counts towards the game budget
+void TimeBudget::chargeCallback(const int player_id, const clock::duration elapsed) {
+    used_[player_id] += elapsed;
+}
+
+// The player went over its per-game budget
+bool TimeBudget::isExhausted(const int player_id) const {
+    return gameBudget_ != clock::duration::zero() && used_[player_id] > gameBudget_;
+}
@@ -0,0 +1,73 @@
+# include "WorkerPool.h"
+
+#include <algorithm>
+
+// Start the workers
+WorkerPool::WorkerPool(const size_t num_threads) {
+    threads_.reserve(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) { threads_.emplace_back([this] { workerLoop(); }); }
+}
+
+// Stop and join the workers
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& thread : threads_) { thread.join(); }
+}
+
+// Process-wide pool, one worker per spare hardware thread (the caller of parallelFor is the other one)
+WorkerPool& WorkerPool::shared() {
+    static WorkerPool pool(std::max(std::thread::hardware_concurrency(), 2u) - 1);
+    return pool;
+}
+
+// Run body(0..count-1) on the workers and the calling thread, returns when every item ran
+void WorkerPool::parallelFor(const size_t count, const function<void(size_t)>& body) {
+    if (count == 0) { return; }
+
+    Job job;
+    job.body = &body;
+    job.count = count;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        jobs_.push_back(&job);
+    }
+    wake_.notify_all();
+
+    runItems(job); // Returns once every item is claimed
+
+    // Items claimed by workers are done once they leave the job
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (const auto it = std::find(jobs_.begin(), jobs_.end(), &job); it != jobs_.end()) { jobs_.erase(it); }
+    left_.wait(lock, [&job] { return job.users == 0; });
+}
+
+// Take jobs from the queue until stopped
+void WorkerPool::workerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        wake_.wait(lock, [this] { return stop_ || !jobs_.empty(); });
+        if (stop_) { return; }
+
+        Job* job = jobs_.front();
+        if (job->next.load(std::memory_order_relaxed) >= job->count) { jobs_.pop_front(); continue; } // All claimed
+
+        ++job->users;
+        lock.unlock();
+        runItems(*job);
+        lock.lock();
+        --job->users;
+        left_.notify_all();
+    }
+}
+
+// Claim and run items until none are left
+void WorkerPool::runItems(Job& job) {
+    for (size_t i = job.next.fetch_add(1, std::memory_order_relaxed); i < job.count;
+         i = job.next.fetch_add(1, std::memory_order_relaxed)) {
+        (*job.body)(i);
+    }
+}
@@ -0,0 +1,96 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "GM_209277367_322542887.h"
+#include "GameManagerRegistration.h"
+
+using namespace std;
+using GameManager_209277367_322542887::GM_209277367_322542887;
+
+/*
+  mapreplay — inspect a binary replay recorded by the GameManager (replay_folder=<folder>).
+
+  Seeks to any turn by restoring the nearest keyframe at or before it and re-simulating the
+  recorded actions with the GameManager engine; the tank algorithms are never run.
+
+  Usage:
+    ./mapreplay --in game.replay [--turn N] [--info]
+*/
+
+// The engine is linked in directly, so there is no Simulator registrar to register with.
+GameManagerRegistration::GameManagerRegistration(GameManagerFactory) {}
+
+struct Options {
+  string inPath;
+  size_t turn = 0;
+  bool infoOnly = false;
+};
+
+static void usage(const char* a0){
+  cerr <<
+  "mapreplay - seek into a recorded game replay\n"
+  "Usage:\n"
+  "  " << a0 << " --in <game.replay> [--turn <N>] [--info]\n";
+}
+
+static const char* actionName(ActionRequest a){
+  static const char* names[] = {"MoveForward", "MoveBackward", "RotateLeft90", "RotateRight90",
+                                "RotateLeft45", "RotateRight45", "Shoot", "GetBattleInfo", "DoNothing"};
+  const auto i = static_cast<size_t>(a);
+  return i < size(names) ? names[i] : "Unknown Action";
+}
+
+static void printInfo(const ReplayReader& r){
+  const ReplayHeader& h = r.getHeader();
+  cout << "Board:     " << h.width << "x" << h.height << "\n"
+       << "MaxSteps:  " << h.maxSteps << "\n"
+       << "NumShells: " << h.numShells << "\n"
+       << "Tanks:     " << h.numTanks << "\n"
+       << "Turns:     " << r.getTurnCount() << " (keyframe every " << h.keyframeInterval << ")\n"
+       << "Map:       " << hex << h.mapFingerprint << dec << "\n";
+}
+
+int main(int argc, char** argv){
+  Options opt;
+  for(int i=1;i<argc;++i){
+    string a=argv[i];
+    auto need=[&](int k){ return i+k<argc; };
+    if(a=="--in" && need(1))        { opt.inPath = argv[++i]; }
+    else if(a=="--turn" && need(1)) { opt.turn = stoul(argv[++i]); }
+    else if(a=="--info")            { opt.infoOnly = true; }
+    else { cerr<<"Unknown or incomplete arg: "<<a<<"\n"; usage(argv[0]); return 1; }
+  }
+  if(opt.inPath.empty()){ usage(argv[0]); return 1; }
+
+  ReplayReader replay;
+  string error;
+  if(!replay.load(opt.inPath, error)){ cerr << "ERROR: " << error << "\n"; return 2; }
+
+  printInfo(replay);
+  if(opt.infoOnly) return 0;
+
+  if(opt.turn > replay.getTurnCount()){
+    cerr << "ERROR: turn " << opt.turn << " is past the last recorded turn (" << replay.getTurnCount() << ")\n";
+    return 1;
+  }
+
+  GM_209277367_322542887 gm(false);
+  if(!gm.replayTo(replay, opt.turn)){
+    cerr << "ERROR: re-simulation diverged from the recording (replay made by a different engine?)\n";
+    return 2;
+  }
+
+  cout << "\nBoard at the start of turn " << opt.turn << (gm.isGameOver() ? " (game over)" : "") << ":\n";
+  gm.printBoard();
+
+  if(opt.turn < replay.getTurnCount()){
+    vector<pair<ActionRequest, bool>> actions;
+    replay.getActions(opt.turn, actions);
+    cout << "\nActions in turn " << opt.turn << ":\n";
+    for(size_t i=0;i<actions.size();++i){
+      cout << "  tank " << i << ": " << actionName(actions[i].first) << (actions[i].second ? "" : " (ignored)") << "\n";
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "AlgorithmRegistrar.h"
+#include "AbstractGameManager.h"
+
+using std::unique_ptr, std::string, std::vector, std::function, std::unordered_map;
+
+// What one worker thread keeps from one game to the next. Players and tank algorithms that follow
+// the reset protocol (UserCommon/Resettable.h) are reset and handed out again instead of being
+// created anew, and a GameManager that supports it (ExtGameManager) plays one game after another,
+// so their buffers keep their capacity. Anything else is created and destroyed per game, as before.
+// Not thread safe: each worker owns its own pool, and destroys it before the libraries are unloaded.
+class InstancePool {
+public:
+    InstancePool() = default;
+    InstancePool(const InstancePool&) = delete;
+    InstancePool& operator=(const InstancePool&) = delete;
+    InstancePool(InstancePool&&) = delete;
+    InstancePool& operator=(InstancePool&&) = delete;
+    ~InstancePool() = default;
+
+    // GameManager for the next game: the one kept from the last game, or a new one from create
+    unique_ptr<AbstractGameManager> takeGameManager(const function<unique_ptr<AbstractGameManager>()>& create);
+    void returnGameManager(unique_ptr<AbstractGameManager> gameManager); // Kept if it can play again
+
+    // Player of algo for the next game: a kept one, reset with these arguments, or a new one
+    unique_ptr<Player> takePlayer(const AlgorithmRegistrar::AlgorithmAndPlayerFactories& algo, int player_index,
+        size_t x, size_t y, size_t max_steps, size_t num_shells);
+    void returnPlayer(const string& algoName, unique_ptr<Player> player); // Kept if it can be reset
+
+    // Tank algorithm factory of algo that resets and hands out kept instances before creating new ones
+    TankAlgorithmFactory tankAlgorithmFactory(const AlgorithmRegistrar::AlgorithmAndPlayerFactories& algo);
+    // Take back the tank algorithms of a finished game whose players ran algorithms name1 and name2
+    void returnTankAlgorithms(AbstractGameManager& gameManager, const string& name1, const string& name2);
+
+private:
+    struct Kept {
+        vector<unique_ptr<Player>> players; // Resettable players, ready for another game
+        vector<unique_ptr<TankAlgorithm>> tanks; // Resettable tank algorithms, ready for another game
+    };
+
+    unordered_map<string, Kept> byAlgorithm_; // Kept instances per algorithm name
+    unique_ptr<AbstractGameManager> gameManager_; // Kept GameManager, if it supports reuse
+};
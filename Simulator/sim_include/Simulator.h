@@ -11,6 +11,7 @@
 #include <mutex>
 #include "AbstractGameManager.h"
 #include "../UserCommon/UC_include/ExtSatelliteView.h"
+#include "../UserCommon/UC_include/GameManagerOptions.h"
 #include "logger.h"
 
 namespace fs = std::filesystem;
@@ -26,32 +27,38 @@ public:
     Simulator& operator=(Simulator&&) = delete;
     virtual ~Simulator() = default;
 
+    // Engine options forwarded to GameManagers that support them (ExtGameManager)
+    void setGameManagerOptions(const GameManagerOptions& options);
+
 protected:
     struct MapData {
-        int numShells;
-        int cols = 0;
-        int rows = 0;
+        size_t numShells = 0;
+        size_t cols = 0;
+        size_t rows = 0;
         std::string name;
-        int maxSteps;
+        size_t maxSteps = 0;
         bool failedInit;
-        unique_ptr<ExtSatelliteView> satelliteView = nullptr;
+        ExtSatelliteView satelliteView{BoardImage()}; // Empty until the board is read
         ofstream* inputErrors = nullptr;
     };
 
     bool verbose_;
     size_t numThreads_;
     utils::Logger& logger_;
+    GameManagerOptions gmOptions_;
 
     MapData readMap(const std::string& file_path);
     string timestamp();
+    void applyGameManagerOptions(AbstractGameManager& gameManager) const;
+    void reportTimeBudget(const AbstractGameManager& gameManager, const string& game) const;
 
 private:
-    bool extractLineValue(const std::string& line, int& value, const std::string& key, const size_t line_number,
+    bool extractLineValue(const std::string& line, size_t& value, const std::string& key, const size_t line_number,
         Simulator::MapData &mapData, ofstream &inputErrors);
     bool extractValues(Simulator::MapData &mapData, ifstream& inputFile, ofstream &inputErrors);
-    tuple<bool, int, int> fillGameBoard(vector<vector<char>> &gameBoard, ifstream &file, Simulator::MapData &mapData,
+    tuple<bool, size_t, size_t> fillGameBoard(TiledBoard &gameBoard, ifstream &file, Simulator::MapData &mapData,
         ofstream &inputErrors);
-    bool checkForExtras(int extraRows, int extraCols, ofstream &inputErrors);
+    bool checkForExtras(size_t extraRows, size_t extraCols, ofstream &inputErrors);
 
     std::optional<MapData> map_;
 };
@@ -3,6 +3,7 @@
 #include <unordered_map>
 #include <vector>
 #include <optional>
+#include "../UserCommon/UC_include/GameManagerOptions.h"
 
 class CmdParser {
 public:
@@ -23,6 +24,9 @@ public:
         std::optional<int> numThreads;
         bool verbose = false;
 
+        // GameManager engine options
+        UserCommon_209277367_322542887::GameManagerOptions gmOptions;
+
         // Logger
         bool enableLogging = false;
         bool debug = false;
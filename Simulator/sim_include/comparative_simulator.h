@@ -9,8 +9,10 @@
 #include "AlgorithmRegistrar.h"
 #include "GameManagerRegistrar.h"
 #include "Simulator.h"
+#include "InstancePool.h"
 #include "GameResult.h"
 #include "AbstractGameManager.h"
+#include "../UserCommon/UC_include/ViewAccess.h"
 
 using std::string, std::filesystem::path, std::shared_ptr, std::vector, std::unordered_map, std::mutex;
 
@@ -51,7 +53,7 @@ private:
     void getGameManagers(const string& gameManagerFolder);
     // bool loadGameManagers(const vector<path>& gms_Paths);
     void runGames();
-    void runSingleGame(const path& gmPath);
+    void runSingleGame(const path& gmPath, InstancePool& pool);
 
     bool errorHandle (bool condition ,const string& msg, void* gm_handle, const string& name = "");
 
@@ -59,7 +61,7 @@ private:
         int winner;
         GameResult::Reason reason;
         std::vector<size_t> remaining_tanks;
-        std::vector<std::vector<char>> board; // hard copy of final board
+        BoardImage board; // Final board, owned by the simulator (outlives the GameManager's .so)
         size_t rounds;
     };
 
@@ -73,12 +75,10 @@ private:
             return snap; // Return empty snapshot
         }
 
-        snap.board.resize(rows, std::vector<char>(cols));
-        for (size_t y = 0; y < rows; ++y) {
-            for (size_t x = 0; x < cols; ++x) {
-                snap.board[y][x] = gr.gameState->getObjectAt(x, y);
-            }
-        }
+        // One flat copy, a memcpy when the view is one of ours
+        std::vector<char> cells(rows * cols);
+        copyView(*gr.gameState, cols, rows, cells.data());
+        snap.board = BoardImage(cols, rows, std::move(cells));
         return snap;
     }
 
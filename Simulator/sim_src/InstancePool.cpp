@@ -0,0 +1,95 @@
+#include "InstancePool.h"
+#include "../UserCommon/UC_include/ExtGameManager.h"
+#include "../UserCommon/UC_include/Resettable.h"
+
+using namespace UserCommon_209277367_322542887;
+
+/**
+ * @brief Returns the GameManager for the next game.
+ *
+ * The GameManager kept from the previous game is handed out again as is:
+ * ExtGameManager::run() sets up all per-game state itself, and options
+ * applied once stay applied.
+ *
+ * @param create Creates (and configures) a GameManager when none is kept.
+ * @return The GameManager, or nullptr if create failed.
+ */
+unique_ptr<AbstractGameManager> InstancePool::takeGameManager(const function<unique_ptr<AbstractGameManager>()>& create) {
+    if (gameManager_) { return std::move(gameManager_); }
+    return create();
+}
+
+/**
+ * @brief Keeps a GameManager for the next game if it supports reuse.
+ *
+ * @param gameManager GameManager whose game is over; destroyed unless it is an ExtGameManager.
+ */
+void InstancePool::returnGameManager(unique_ptr<AbstractGameManager> gameManager) {
+    if (dynamic_cast<ExtGameManager*>(gameManager.get())) { gameManager_ = std::move(gameManager); }
+}
+
+/**
+ * @brief Returns a player of @p algo for the next game.
+ *
+ * A kept player is reset with the arguments the factory would get;
+ * otherwise the algorithm's player factory creates a new one.
+ */
+unique_ptr<Player> InstancePool::takePlayer(const AlgorithmRegistrar::AlgorithmAndPlayerFactories& algo,
+        const int player_index, const size_t x, const size_t y, const size_t max_steps, const size_t num_shells) {
+    auto& kept = byAlgorithm_[algo.name()].players;
+    if (kept.empty()) { return algo.createPlayer(player_index, x, y, max_steps, num_shells); }
+
+    unique_ptr<Player> player = std::move(kept.back());
+    kept.pop_back();
+    dynamic_cast<ResettablePlayer&>(*player).reset(player_index, x, y, max_steps, num_shells);
+    return player;
+}
+
+/**
+ * @brief Keeps a player for a later game of the same algorithm if it can be reset.
+ *
+ * @param algoName Algorithm the player belongs to.
+ * @param player Player whose game is over; destroyed unless it is a ResettablePlayer.
+ */
+void InstancePool::returnPlayer(const string& algoName, unique_ptr<Player> player) {
+    if (dynamic_cast<ResettablePlayer*>(player.get())) { byAlgorithm_[algoName].players.push_back(std::move(player)); }
+}
+
+/**
+ * @brief Wraps the tank algorithm factory of @p algo to hand out kept instances first.
+ *
+ * The returned factory is called by the GameManager on this worker's thread,
+ * while the pool is alive.
+ */
+TankAlgorithmFactory InstancePool::tankAlgorithmFactory(const AlgorithmRegistrar::AlgorithmAndPlayerFactories& algo) {
+    return [&kept = byAlgorithm_[algo.name()].tanks, factory = algo.getTankAlgorithmFactory()](int player_index, int tank_index) {
+        if (kept.empty()) { return factory(player_index, tank_index); }
+
+        unique_ptr<TankAlgorithm> tank = std::move(kept.back());
+        kept.pop_back();
+        dynamic_cast<ResettableTankAlgorithm&>(*tank).reset(player_index, tank_index);
+        return tank;
+    };
+}
+
+/**
+ * @brief Takes back the tank algorithms of a finished game.
+ *
+ * Only an ExtGameManager can hand its tank algorithms back; those that can
+ * be reset are kept under their algorithm's name, the rest are destroyed.
+ *
+ * @param gameManager GameManager whose game is over (before it is destroyed or reused).
+ * @param name1 Algorithm of player 1.
+ * @param name2 Algorithm of player 2.
+ */
+void InstancePool::returnTankAlgorithms(AbstractGameManager& gameManager, const string& name1, const string& name2) {
+    auto* extGameManager = dynamic_cast<ExtGameManager*>(&gameManager);
+    if (!extGameManager) { return; }
+
+    for (const int player : {1, 2}) {
+        auto& kept = byAlgorithm_[player == 1 ? name1 : name2].tanks;
+        for (auto& tank : extGameManager->releaseTankAlgorithms(player)) {
+            if (dynamic_cast<ResettableTankAlgorithm*>(tank.get())) { kept.push_back(std::move(tank)); }
+        }
+    }
+}
@@ -1,20 +1,66 @@
 #include "Simulator.h"
+#include "../UserCommon/UC_include/ExtGameManager.h"
 
 Simulator::Simulator(bool verbose, size_t numThreads)
     : verbose_(verbose), numThreads_(numThreads), logger_(utils::Logger::get()) {}
 
 /**
- * @brief Extracts an integer value from a configuration line in the map file.
+ * @brief Sets the engine options passed to every GameManager created from now on.
+ *
+ * @param options Options parsed from the command line.
+ */
+void Simulator::setGameManagerOptions(const GameManagerOptions& options) {
+    gmOptions_ = options;
+}
+
+/**
+ * @brief Forwards the engine options to a GameManager, if it supports them.
+ *
+ * Only GameManagers implementing ExtGameManager accept options; any other
+ * GameManager is left untouched and runs with its own defaults.
+ *
+ * @param gameManager Freshly created GameManager, before run() is called.
+ */
+void Simulator::applyGameManagerOptions(AbstractGameManager& gameManager) const {
+    if (auto* extGameManager = dynamic_cast<ExtGameManager*>(&gameManager)) {
+        extGameManager->setOptions(gmOptions_);
+    }
+}
+
+/**
+ * @brief Warns about players that went over their time budget in a game.
+ *
+ * Reports, per player, how many getAction calls were played as DoNothing for
+ * taking too long and whether the player forfeited the game. Nothing is
+ * printed when no budget is set or nobody went over it.
+ *
+ * @param gameManager GameManager that has just finished run().
+ * @param game Description of the game for the warning (map and players).
+ */
+void Simulator::reportTimeBudget(const AbstractGameManager& gameManager, const string& game) const {
+    const auto* extGameManager = dynamic_cast<const ExtGameManager*>(&gameManager);
+    if (!extGameManager) { return; }
+
+    const BudgetReport report = extGameManager->getBudgetReport();
+    for (size_t i = 0; i < 2; ++i) {
+        if (report.overruns[i] == 0 && !report.forfeited[i]) { continue; }
+        logger_.reportWarn("Player ", i + 1, " exceeded its time budget in ", game, ": ", report.overruns[i],
+            " slow action(s) played as DoNothing", report.forfeited[i] ? ", forfeited the game" : "");
+    }
+}
+
+/**
+ * @brief Extracts a non-negative integer value from a configuration line in the map file.
  *
  * @param line The line to extract the value from.
- * @param value Reference to the integer where the extracted value will be stored.
+ * @param value Reference to the size where the extracted value will be stored.
  * @param key The key expected in the line (e.g., "MaxSteps").
  * @param line_number The current line number (used for error reporting).
  * @param mapData Reference to the map data structure to flag failure if needed.
  * @param inputErrors Stream to write input-related error messages.
  * @return true if the value was successfully extracted, false otherwise.
  */
-bool Simulator::extractLineValue(const std::string &line, int &value, const std::string &key, const size_t line_number,
+bool Simulator::extractLineValue(const std::string &line, size_t &value, const std::string &key, const size_t line_number,
     Simulator::MapData &mapData, ofstream &inputErrors) {
 
     std::string no_space_line;
@@ -23,12 +69,14 @@ bool Simulator::extractLineValue(const std::string &line, int &value, const std:
     }
 
     // Check if the line has the correct format
-    const std::string format = key + "=%d"; // Format for the line
-    if (sscanf(no_space_line.c_str(), format.c_str(), &value) != 1) {
+    const std::string format = key + "=%lld"; // Format for the line
+    long long parsed = 0;
+    if (sscanf(no_space_line.c_str(), format.c_str(), &parsed) != 1 || parsed < 0) {
         inputErrors << "Error: Invalid " << key << " format on line " << line_number << ".\n";
         mapData.failedInit = true;
         return false;
     }
+    value = static_cast<size_t>(parsed);
 
     return true; // Successfully extraction
 }
@@ -98,7 +146,10 @@ bool Simulator::extractValues(Simulator::MapData &mapData, ifstream& file, ofstr
 /**
  * @brief Fills the game board from the remaining lines in the map file.
  *
- * @param gameBoard 2D character grid representing the game map.
+ * Rows are validated into a single row buffer and stored tile by tile, so
+ * empty stretches of a large map never take memory of their own.
+ *
+ * @param gameBoard Tiled board of the declared size, prefilled with spaces.
  * @param file Input file stream pointing to the map file content.
  * @param mapData The associated map metadata.
  * @param inputErrors Stream to record errors like extra rows/columns.
@@ -107,20 +158,13 @@ bool Simulator::extractValues(Simulator::MapData &mapData, ifstream& file, ofstr
  *         - the number of extra rows,
  *         - the number of extra columns.
  */
-tuple<bool, int, int> Simulator::fillGameBoard(vector<vector<char>> &gameBoard, ifstream &file,
+tuple<bool, size_t, size_t> Simulator::fillGameBoard(TiledBoard &gameBoard, ifstream &file,
     Simulator::MapData &mapData, ofstream &inputErrors) {
 
     bool hasErrors = false;
-    int i = 0, extraRows = 0, extraCols = 0;
+    size_t i = 0, extraRows = 0, extraCols = 0;
     string line;
-
-    // Ensure size & prefill with spaces (in case caller didn't)
-    if ((int)gameBoard.size() != mapData.rows ||
-        gameBoard.empty() || (int)gameBoard[0].size() != mapData.cols) {
-        gameBoard.assign(mapData.rows, vector<char>(mapData.cols, ' '));
-    } else {
-        for (auto& row : gameBoard) fill(row.begin(), row.end(), ' ');
-    }
+    string row(mapData.cols, ' ');
 
     auto allowed = [](char c) {
         return c == '#' || c == '@' || c == ' ' || c == '1' || c == '2';
@@ -138,16 +182,16 @@ tuple<bool, int, int> Simulator::fillGameBoard(vector<vector<char>> &gameBoard,
             continue;
         }
 
-        if ((int)line.size() > mapData.cols) {
-            int over = (int)line.size() - mapData.cols;
+        if (line.size() > mapData.cols) {
+            size_t over = line.size() - mapData.cols;
             extraCols += over;
             inputErrors << "Error recovered from: Extra " << over
                         << " columns at row " << i << " ignored.\n";
             hasErrors = true;
         }
 
-        for (int j = 0; j < mapData.cols; ++j) {
-            char cell = (j < (int)line.size()) ? line[j] : ' ';
+        for (size_t j = 0; j < mapData.cols; ++j) {
+            char cell = (j < line.size()) ? line[j] : ' ';
             if (!allowed(cell)) {
                 inputErrors << "Error recovered from: Unknown character '"
                             << (cell == '\r' ? '\\' : cell)
@@ -156,8 +200,9 @@ tuple<bool, int, int> Simulator::fillGameBoard(vector<vector<char>> &gameBoard,
                 cell = ' ';
                 hasErrors = true;
             }
-            gameBoard[i][j] = cell; // assign AFTER validation
+            row[j] = cell; // assign AFTER validation
         }
+        gameBoard.assignRow(i, row.data());
         ++i;
     }
 
@@ -172,7 +217,7 @@ tuple<bool, int, int> Simulator::fillGameBoard(vector<vector<char>> &gameBoard,
  * @param inputErrors Stream to write the error recovery information.
  * @return true if any extra rows or columns were detected, false otherwise.
  */
-bool Simulator::checkForExtras(int extraRows, int extraCols, ofstream &inputErrors) {
+bool Simulator::checkForExtras(size_t extraRows, size_t extraCols, ofstream &inputErrors) {
     bool hasErrors = false;
 
     // Check for extra rows and columns
@@ -196,7 +241,7 @@ bool Simulator::checkForExtras(int extraRows, int extraCols, ofstream &inputErro
  * @return Initialized MapData object. If any error occurs, MapData.failedInit will be set to true.
  */
 Simulator::MapData Simulator::readMap(const std::string& file_path) {
-    int extraRows = 0, extraCols = 0;
+    size_t extraRows = 0, extraCols = 0;
     MapData mapData;
     mapData.failedInit = false; // Reset failedInit flag
     string line;
@@ -217,10 +262,9 @@ Simulator::MapData Simulator::readMap(const std::string& file_path) {
 
     if (!extractValues(mapData, file, input_errors)) { return mapData; }
 
-    vector<vector<char>> gameBoard;
-    gameBoard.resize(mapData.rows, vector<char>(mapData.cols, ' '));
+    TiledBoard gameBoard(mapData.cols, mapData.rows);
     tie(has_errors, extraRows, extraCols) = fillGameBoard(gameBoard, file, mapData, input_errors);
-    mapData.satelliteView = std::make_unique<ExtSatelliteView>(mapData.cols, mapData.rows, gameBoard);
+    mapData.satelliteView = ExtSatelliteView(std::move(gameBoard));
 
     has_errors = has_errors ? has_errors : checkForExtras(extraRows, extraCols, input_errors);
 
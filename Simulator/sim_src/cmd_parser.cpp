@@ -16,11 +16,11 @@ namespace {
 
     // Allowed argument keys for comparative and competition modes
     static const std::vector<std::string> validComparativeKeys = {
-        "game_map", "game_managers_folder", "algorithm1", "algorithm2", "num_threads"
+        "game_map", "game_managers_folder", "algorithm1", "algorithm2", "num_threads", "shell_engine", "shell_bands", "replay_folder", "stats_folder", "action_budget_ms", "game_budget_ms", "parallel_actions", "cycle_detection"
     };
 
     static const std::vector<std::string> validCompetitionKeys = {
-        "game_maps_folder", "game_manager", "algorithms_folder", "num_threads"
+        "game_maps_folder", "game_manager", "algorithms_folder", "num_threads", "shell_engine", "shell_bands", "replay_folder", "stats_folder", "action_budget_ms", "game_budget_ms", "parallel_actions", "cycle_detection"
     };
 
     /**
@@ -122,6 +122,108 @@ namespace {
         }
     }
 
+    /**
+     * @brief Parses the optional "shell_engine" argument.
+     *
+     * Accepts "stepwise" (default when missing), "event" or "banded". Any other value is
+     * rejected without modifying the output parameter.
+     *
+     * @param kv Map of parsed key-value arguments.
+     * @param out Reference to the options whose shell engine is set.
+     * @return True if parsing succeeds, false otherwise.
+     */
+    static bool parseShellEngine(const std::unordered_map<std::string,std::string>& kv,
+                                 UserCommon_209277367_322542887::GameManagerOptions& out) {
+        using UserCommon_209277367_322542887::ShellEngine;
+        auto it = kv.find("shell_engine");
+        if (it == kv.end()) { out.shellEngine = ShellEngine::Stepwise; return true; }
+        if (it->second == "stepwise") { out.shellEngine = ShellEngine::Stepwise; return true; }
+        if (it->second == "event") { out.shellEngine = ShellEngine::Event; return true; }
+        if (it->second == "banded") { out.shellEngine = ShellEngine::Banded; return true; }
+        return false;
+    }
+
+    /**
+     * @brief Parses the optional "shell_bands" argument.
+     *
+     * The number of board bands of the banded shell engine, digits only;
+     * 0 (the default when missing) picks one band per worker thread.
+     *
+     * @param kv Map of parsed key-value arguments.
+     * @param out Reference to the option that receives the band count.
+     * @return True if parsing succeeds, false otherwise.
+     */
+    static bool parseShellBands(const std::unordered_map<std::string,std::string>& kv, size_t& out) {
+        auto it = kv.find("shell_bands");
+        if (it == kv.end()) { out = 0; return true; }
+        const std::string& s = it->second;
+        if (s.empty() || s.size() > 6 || !std::all_of(s.begin(), s.end(), [](unsigned char c){ return std::isdigit(c); })) return false;
+        out = static_cast<size_t>(std::stoul(s));
+        return true;
+    }
+
+    /**
+     * @brief Parses an optional output folder argument ("replay_folder", "stats_folder").
+     *
+     * When present, the value must name an existing folder; the GameManager
+     * then writes one file per game into it. Missing means nothing is written.
+     *
+     * @param kv Map of parsed key-value arguments.
+     * @param key Argument name.
+     * @param out Reference to the option that receives the folder.
+     * @return True if parsing succeeds, false otherwise.
+     */
+    static bool parseOutputFolder(const std::unordered_map<std::string,std::string>& kv,
+                                  const std::string& key, std::string& out) {
+        auto it = kv.find(key);
+        if (it == kv.end()) { out.clear(); return true; }
+        std::error_code ec;
+        if (it->second.empty() || !fs::is_directory(it->second, ec)) return false;
+        out = it->second;
+        return true;
+    }
+
+    /**
+     * @brief Parses an optional time budget argument ("action_budget_ms", "game_budget_ms").
+     *
+     * The value is a whole number of milliseconds, digits only; 0 (the default
+     * when missing) means no limit.
+     *
+     * @param kv Map of parsed key-value arguments.
+     * @param key Argument name.
+     * @param out Reference to the option that receives the budget.
+     * @return True if parsing succeeds, false otherwise.
+     */
+    static bool parseBudgetMs(const std::unordered_map<std::string,std::string>& kv,
+                              const std::string& key, size_t& out) {
+        auto it = kv.find(key);
+        if (it == kv.end()) { out = 0; return true; }
+        const std::string& s = it->second;
+        if (s.empty() || s.size() > 9 || !std::all_of(s.begin(), s.end(), [](unsigned char c){ return std::isdigit(c); })) return false;
+        out = static_cast<size_t>(std::stoul(s));
+        return true;
+    }
+
+    /**
+     * @brief Parses an optional on/off argument ("parallel_actions", "cycle_detection").
+     *
+     * Accepts "off" (default when missing) or "on". With "cycle_detection" on, a
+     * game whose tank algorithms all declare themselves stateless can be ended
+     * early with its max-steps outcome once its state repeats.
+     *
+     * @param kv Map of parsed key-value arguments.
+     * @param key Argument name.
+     * @param out Reference to the flag that is set.
+     * @return True if parsing succeeds, false otherwise.
+     */
+    static bool parseSwitch(const std::unordered_map<std::string,std::string>& kv,
+                            const std::string& key, bool& out) {
+        auto it = kv.find(key);
+        if (it == kv.end() || it->second == "off") { out = false; return true; }
+        if (it->second == "on") { out = true; return true; }
+        return false;
+    }
+
     // ==== small utils (add next to your existing helpers) ====
     inline std::string absoluteForMsg(const std::string& p) {
         std::error_code ec;
@@ -366,6 +468,13 @@ namespace {
  *
  * Also handles optional arguments:
  *   - num_threads (must be a positive integer, default = 1)
+ *   - shell_engine (stepwise, event or banded, default = stepwise)
+ *   - shell_bands (bands of the banded shell engine, default = 0 = one per worker thread)
+ *   - replay_folder (existing folder to record game replays into, default = none)
+ *   - stats_folder (existing folder to write per-game timings and counters into, default = none)
+ *   - action_budget_ms / game_budget_ms (time budgets for the algorithms in milliseconds, default = 0 = none)
+ *   - parallel_actions (off or on, default = off)
+ *   - cycle_detection (off or on, default = off)
  *   - -verbose flag for verbose output
  *
  * The parser reports and fails on:
@@ -426,6 +535,26 @@ CmdParser::ParseResult CmdParser::parse(int argc, char** argv) {
     if (!parseNumThreadsStrict(nz.kv, threads)) errors.emplace_back("Invalid value for num_threads (must be a positive integer).");
     res.numThreads = threads;
 
+    // shell_engine validation (default to stepwise when absent)
+    if (!parseShellEngine(nz.kv, res.gmOptions)) errors.emplace_back("Invalid value for shell_engine (must be stepwise, event or banded).");
+
+    // shell_bands validation (automatic when absent)
+    if (!parseShellBands(nz.kv, res.gmOptions.shellBands)) errors.emplace_back("Invalid value for shell_bands (must be a number of bands).");
+
+    // replay_folder validation (no replays when absent)
+    if (!parseOutputFolder(nz.kv, "replay_folder", res.gmOptions.replayFolder)) errors.emplace_back("Invalid value for replay_folder (must be an existing folder).");
+
+    // stats_folder validation (no stats files when absent)
+    if (!parseOutputFolder(nz.kv, "stats_folder", res.gmOptions.statsFolder)) errors.emplace_back("Invalid value for stats_folder (must be an existing folder).");
+
+    // action_budget_ms / game_budget_ms validation (no limit when absent)
+    if (!parseBudgetMs(nz.kv, "action_budget_ms", res.gmOptions.actionBudgetMs)) errors.emplace_back("Invalid value for action_budget_ms (must be a number of milliseconds).");
+    if (!parseBudgetMs(nz.kv, "game_budget_ms", res.gmOptions.gameBudgetMs)) errors.emplace_back("Invalid value for game_budget_ms (must be a number of milliseconds).");
+
+    // parallel_actions / cycle_detection validation (default to off when absent)
+    if (!parseSwitch(nz.kv, "parallel_actions", res.gmOptions.parallelActions)) errors.emplace_back("Invalid value for parallel_actions (must be off or on).");
+    if (!parseSwitch(nz.kv, "cycle_detection", res.gmOptions.cycleDetection)) errors.emplace_back("Invalid value for cycle_detection (must be off or on).");
+
     if (!errors.empty()) {
         std::string msg;
         for (auto& e : errors) msg += e + '\n';
@@ -452,9 +581,9 @@ void CmdParser::printUsage() {
         << "  ./simulator_<ids> -comparative "
            "game_map=<file> game_managers_folder=<folder> "
            "algorithm1=<file> algorithm2=<file> "
-           "[num_threads=<n>] [-verbose] [-logger[=<path>]] [-debug]\n\n"
+           "[num_threads=<n>] [shell_engine=stepwise|event|banded] [shell_bands=<n>] [replay_folder=<folder>] [stats_folder=<folder>] [action_budget_ms=<n>] [game_budget_ms=<n>] [parallel_actions=off|on] [cycle_detection=off|on] [-verbose] [-logger[=<path>]] [-debug]\n\n"
         << "  ./simulator_<ids> -competition "
            "game_maps_folder=<folder> game_manager=<file> "
            "algorithms_folder=<folder> "
-           "[num_threads=<n>] [-verbose] [-logger[=<path>]] [-debug]\n";
+           "[num_threads=<n>] [shell_engine=stepwise|event|banded] [shell_bands=<n>] [replay_folder=<folder>] [stats_folder=<folder>] [action_budget_ms=<n>] [game_budget_ms=<n>] [parallel_actions=off|on] [cycle_detection=off|on] [-verbose] [-logger[=<path>]] [-debug]\n";
 }
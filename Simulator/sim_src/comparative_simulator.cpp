@@ -265,8 +265,9 @@ void ComparativeSimulator::runGames() {
     size_t threadCount = std::min(numThreads_, gms_paths_.size());
     if (threadCount == 1) { // Main thread runs all games sequentially
         logger_.debug("Running all games sequentially on the main thread.");
+        InstancePool pool; // Players and tank algorithms reused from game to game
         for (const auto& task : gms_paths_) {
-            runSingleGame(task); // Run all games sequentially if only one thread
+            runSingleGame(task, pool); // Run all games sequentially if only one thread
         }
         return;
     }
@@ -278,13 +279,14 @@ void ComparativeSimulator::runGames() {
 
     // Worker workflow
     auto worker = [&]() {
+        InstancePool pool; // This worker's players and tank algorithms, reused from game to game
         while (true) {
             path gmPath;
             size_t idx = nextGameManagers.fetch_add(1, std::memory_order_relaxed);
             // Make sure each game is safely grabbed by a single thread
             if (idx >= gms_paths_.size()) return;
             gmPath = gms_paths_[idx];
-            runSingleGame(gmPath); // Runs the scheduled game
+            runSingleGame(gmPath, pool); // Runs the scheduled game
             logger_.debug("Thread ", std::this_thread::get_id(), " completed game with GameManager: ", gmPath.string());
         }
     };
@@ -313,9 +315,14 @@ void ComparativeSimulator::runGames() {
  * After execution, the GameManager entry is removed from the registrar and the
  * shared object handle is closed.
  *
+ * Players and tank algorithms come from the worker's @p pool and go back to
+ * it after the game, so those that support reuse keep their buffers. Each
+ * GameManager plays a single game here, so GameManagers are not kept.
+ *
  * @param gmPath Path to the GameManager `.so` file to load and execute.
+ * @param pool The calling worker's pool of reusable objects.
  */
-void ComparativeSimulator::runSingleGame(const path& gmPath) {
+void ComparativeSimulator::runSingleGame(const path& gmPath, InstancePool& pool) {
     logger_.debug("Thread ", std::this_thread::get_id(), " running game with GameManager: ", gmPath.string());
     string gm_name = gmPath.stem().string();
     // load .so file for Game Manager
@@ -334,27 +341,34 @@ void ComparativeSimulator::runSingleGame(const path& gmPath) {
             // Create the GameManager instance
             gameManager = gm.create(verbose_);
             createdGameManager = (gameManager != nullptr);
+            if (createdGameManager) applyGameManagerOptions(*gameManager);
             logger_.debug("Thread ", std::this_thread::get_id(), " created GameManager instance for: ", gm_name);
         }
         
         if (errorHandle(!createdGameManager, "Failed to create GameManager instance for: ", gm_handle, gm_name)) return;
 
         // Create players using the algorithm factories
-        unique_ptr<Player> player1 = algo1_->createPlayer(0, mapData_.cols, mapData_.rows, mapData_.maxSteps, mapData_.numShells);
-        unique_ptr<Player> player2 = algo2_->createPlayer(1, mapData_.cols, mapData_.rows, mapData_.maxSteps, mapData_.numShells);
+        unique_ptr<Player> player1 = pool.takePlayer(*algo1_, 0, mapData_.cols, mapData_.rows, mapData_.maxSteps, mapData_.numShells);
+        unique_ptr<Player> player2 = pool.takePlayer(*algo2_, 1, mapData_.cols, mapData_.rows, mapData_.maxSteps, mapData_.numShells);
         if (errorHandle(!player1 || !player2, "Failed to create one (or more) of the players", gm_handle)) return;
 
         // Get algorithm names and factories
         string name1 = algo1_->name();
         string name2 = algo2_->name();
-        TankAlgorithmFactory tankAlgorithmFactory1 = algo1_->getTankAlgorithmFactory();
-        TankAlgorithmFactory tankAlgorithmFactory2 = algo2_->getTankAlgorithmFactory();
+        TankAlgorithmFactory tankAlgorithmFactory1 = pool.tankAlgorithmFactory(*algo1_);
+        TankAlgorithmFactory tankAlgorithmFactory2 = pool.tankAlgorithmFactory(*algo2_);
         logger_.debug("Thread ", std::this_thread::get_id(), " created players: ", name1, " and ", name2, " for GameManager: ", gm_name);
 
         // Run game manager with players and factories
         logger_.info("Thread ", std::this_thread::get_id(), " starting game with GameManager: ", gm_name);
-        GameResult result = gameManager->run(mapData_.cols, mapData_.rows, *mapData_.satelliteView, mapData_.name,
+        GameResult result = gameManager->run(mapData_.cols, mapData_.rows, mapData_.satelliteView, mapData_.name,
             mapData_.maxSteps, mapData_.numShells, *player1, name1, *player2, name2, tankAlgorithmFactory1, tankAlgorithmFactory2);
+        reportTimeBudget(*gameManager, gm_name + " on map " + mapData_.name);
+
+        // Keep what can play again; the GameManager goes with its library
+        pool.returnTankAlgorithms(*gameManager, name1, name2);
+        pool.returnPlayer(name1, std::move(player1));
+        pool.returnPlayer(name2, std::move(player2));
 
         // Store the result in allResults
         {
@@ -423,11 +437,10 @@ bool ComparativeSimulator::sameResult(const SnapshotGameResult& a, const Snapsho
     auto norm = [](char c) constexpr { return c == '$' ? '#' : c; };
 
     // Check dimensions, and then each cell
-    if (a.board.size() != b.board.size()) return false;
-    for (size_t y = 0; y < a.board.size(); ++y) {
-        if (a.board[y].size() != b.board[y].size()) return false;
-        for (size_t x = 0; x < a.board[y].size(); ++x) {
-            if (norm(a.board[y][x]) != norm(b.board[y][x])) return false;
+    if (a.board.getWidth() != b.board.getWidth() || a.board.getHeight() != b.board.getHeight()) return false;
+    for (size_t y = 0; y < a.board.getHeight(); ++y) {
+        for (size_t x = 0; x < a.board.getWidth(); ++x) {
+            if (norm(a.board.at(x, y)) != norm(b.board.at(x, y))) return false;
         }
     }
     return true;
@@ -511,17 +524,15 @@ void ComparativeSimulator::writeOutput(const string& mapPath,
  * to keep the output user-facing and consistent with the expected file format.
  *
  * @param os Output stream to write the board to (e.g., a file or std::cout).
- * @param result Snapshot of a single game's final state, including a @c board matrix.
- *
- * @pre @p result.board is a rectangular grid (all rows have identical length).
+ * @param result Snapshot of a single game's final state, including a @c board image.
  * @post The stream @p os is advanced by the full board plus trailing newlines.
  */
 void ComparativeSimulator::printSatellite(std::ostream& os,
                            const SnapshotGameResult& result) {
     // Print the board row by row
-    for (size_t y = 0; y < result.board.size(); ++y) {
-        for (size_t x = 0; x < result.board[y].size(); ++x) {
-            char cell = result.board[y][x];
+    for (size_t y = 0; y < result.board.getHeight(); ++y) {
+        for (size_t x = 0; x < result.board.getWidth(); ++x) {
+            char cell = result.board.at(x, y);
             if (cell == '$') cell = '#'; // $ is an internaly used char
             os << cell;
         }
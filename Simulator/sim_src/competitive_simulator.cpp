@@ -325,8 +325,9 @@ void CompetitiveSimulator::runGames() {
     size_t threadCount = min(numThreads_, scheduledGames_.size()); // Deciede number of threads to use based on scheduled games
     logger_.info("Running games using ", threadCount, " thread(s)...");
     if (threadCount == 1) { // Main thread runs all games sequentially
+        InstancePool pool; // Objects reused from game to game
         for (const auto& task : scheduledGames_) {
-            runSingleGame(task); // Run all games sequentially if only one thread
+            runSingleGame(task, pool); // Run all games sequentially if only one thread
         }
         return;
     }
@@ -338,10 +339,11 @@ void CompetitiveSimulator::runGames() {
     // Worker workflow
     auto worker = [&]() {
         logger_.debug("Thread ", std::this_thread::get_id(), " started.");
+        InstancePool pool; // This worker's objects, reused from game to game
         while (true) {
             size_t idx = nextTask.fetch_add(1, std::memory_order_relaxed);
             if (idx >= scheduledGames_.size()) break;
-            runSingleGame(scheduledGames_[idx]);
+            runSingleGame(scheduledGames_[idx], pool);
             logger_.debug("Thread ", std::this_thread::get_id(), " completed game ", idx + 1, "/", scheduledGames_.size());
         }
     };
@@ -371,9 +373,14 @@ void CompetitiveSimulator::runGames() {
  * If the game map fails to load, or if algorithms are not properly registered,
  * the game is skipped and the error is logged.
  *
+ * The GameManager, players and tank algorithms come from the worker's
+ * @p pool and go back to it after the game, so objects that support reuse
+ * keep their buffers from one game to the next.
+ *
  * @param task Game configuration including map path and participating algorithms.
+ * @param pool The calling worker's pool of reusable objects.
  */
-void CompetitiveSimulator::runSingleGame(const GameTask& task) {
+void CompetitiveSimulator::runSingleGame(const GameTask& task, InstancePool& pool) {
     fs::path mapPath = task.mapPath;
     MapData mapData = readMap(mapPath);
     if (mapData.failedInit) {
@@ -405,22 +412,29 @@ void CompetitiveSimulator::runSingleGame(const GameTask& task) {
             return;
         }
 
-        // Create players
-        auto player1 = algo1->createPlayer(1, mapData.cols, mapData.rows, mapData.maxSteps, mapData.numShells);
-        auto player2 = algo2->createPlayer(2, mapData.cols, mapData.rows, mapData.maxSteps, mapData.numShells);
+        // Create players, or reset kept ones
+        auto player1 = pool.takePlayer(*algo1, 1, mapData.cols, mapData.rows, mapData.maxSteps, mapData.numShells);
+        auto player2 = pool.takePlayer(*algo2, 2, mapData.cols, mapData.rows, mapData.maxSteps, mapData.numShells);
 
         // Run game manager with players and factories
-        auto gm = createGameManager();
+        auto gm = pool.takeGameManager([this] { return createGameManager(); });
         if (!gm) {
             logger_.reportWarn("Failed to create game manager for map: ", mapPath.string());
             return;
         }
         logger_.debug("Thread ", std::this_thread::get_id(), " running game: ",
                    task.algoName1, " vs. ", task.algoName2, " on map ", task.mapPath);
-        GameResult result = gm->run(mapData.cols, mapData.rows, *mapData.satelliteView, mapData.name,
+        GameResult result = gm->run(mapData.cols, mapData.rows, mapData.satelliteView, mapData.name,
             mapData.maxSteps, mapData.numShells,*player1, name1, *player2, name2,
-            algo1->getTankAlgorithmFactory(),algo2->getTankAlgorithmFactory()
+            pool.tankAlgorithmFactory(*algo1), pool.tankAlgorithmFactory(*algo2)
         );
+        reportTimeBudget(*gm, name1 + " vs. " + name2 + " on map " + mapPath.filename().string());
+
+        // Keep what can play again
+        pool.returnTankAlgorithms(*gm, name1, name2);
+        pool.returnGameManager(std::move(gm));
+        pool.returnPlayer(name1, std::move(player1));
+        pool.returnPlayer(name2, std::move(player2));
         
 
         // Use GameResult to update scores
@@ -500,7 +514,9 @@ void CompetitiveSimulator::writeOutput(const string& outFolder,
  * @return unique_ptr to a new AbstractGameManager instance.
  */
 unique_ptr<AbstractGameManager> CompetitiveSimulator::createGameManager() {
-    return gameManagerFactory_(verbose_);
+    auto gameManager = gameManagerFactory_(verbose_);
+    if (gameManager) applyGameManagerOptions(*gameManager);
+    return gameManager;
 }
 
 /**
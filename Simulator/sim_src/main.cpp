@@ -48,6 +48,7 @@ int main(int argc, char** argv) {
     try {
         if (result.mode == CmdParser::Mode::Comparative) {
             ComparativeSimulator comparativeSimulator(result.verbose, (result.numThreads.value()));
+            comparativeSimulator.setGameManagerOptions(result.gmOptions);
             comparativeSimulator.run(
                 result.gameMapFile,
                 result.gameManagersFolder,
@@ -56,6 +57,7 @@ int main(int argc, char** argv) {
             );
         } else if (result.mode == CmdParser::Mode::Competition) {
             CompetitiveSimulator competitiveSimulator(result.verbose, (result.numThreads.value()));
+            competitiveSimulator.setGameManagerOptions(result.gmOptions);
             competitiveSimulator.run(
                 result.gameMapsFolder,
                 result.gameManagerFile,
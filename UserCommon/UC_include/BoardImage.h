@@ -0,0 +1,46 @@
+#pragma once
+
+# include "TiledBoard.h"
+# include <cstddef>
+# include <memory>
+# include <vector>
+
+using std::vector, std::shared_ptr;
+
+namespace UserCommon_209277367_322542887 {
+
+// Immutable board shared by reference count. It is built once, from a row-major buffer taken by
+// move or from a TiledBoard, and copies of the image share the same cells, so a map or a final
+// board can be handed from the loader to the views and results without copying cells.
+class BoardImage {
+public:
+    BoardImage() = default; // Empty 0x0 image
+    BoardImage(size_t width, size_t height, vector<char> cells); // Takes a row-major buffer
+    explicit BoardImage(const vector<vector<char>>& rows); // Rows of equal length, copied once
+    explicit BoardImage(TiledBoard board); // Keeps the tiles, shared as they are
+
+    size_t getWidth() const { return width_; }
+    size_t getHeight() const { return height_; }
+    bool empty() const { return width_ == 0 || height_ == 0; }
+
+    // Cell at (x, y), which must be on the board
+    char at(size_t x, size_t y) const { return dense_ ? dense_[y * width_ + x] : tiled_->get(x, y); }
+    const char* data() const { return dense_; } // Row-major cells, nullptr for a tiled image
+    void copyRow(size_t y, char* out) const; // Write row y (width chars) to out
+
+    bool operator==(const BoardImage& other) const; // Same size and cells
+
+private:
+    struct Cells {
+        vector<char> dense; // Row-major cells of a dense image
+        TiledBoard tiles; // Cells of a tiled image
+    };
+
+    size_t width_ = 0;
+    size_t height_ = 0;
+    shared_ptr<const Cells> cells_; // Shared by every copy of the image
+    const char* dense_ = nullptr; // cells_->dense, nullptr if tiled
+    const TiledBoard* tiled_ = nullptr; // &cells_->tiles if tiled
+};
+
+} // namespace UserCommon_209277367_322542887
@@ -18,17 +18,19 @@ class ExtBattleInfo final : public BattleInfo {
 
     public:
         // Rule of 5
-        ExtBattleInfo(const vector<vector<char>>& gameboard, const vector<pair<int,int>>& shells_location,
-            int num_shells, pair<int, int> initial_loc); // Constructor
+        ExtBattleInfo(vector<vector<char>> gameboard, vector<pair<int,int>> shells_location,
+            int num_shells, pair<int, int> initial_loc); // Constructor, takes the board and shells by move
         ExtBattleInfo(const ExtBattleInfo& other) = default;
-        ExtBattleInfo& operator=(const ExtBattleInfo& other) = delete;
-        ExtBattleInfo(ExtBattleInfo&& other) noexcept = delete;
-        ExtBattleInfo& operator=(ExtBattleInfo&& other) noexcept = delete;
+        ExtBattleInfo& operator=(const ExtBattleInfo& other) = default;
+        ExtBattleInfo(ExtBattleInfo&& other) noexcept = default;
+        ExtBattleInfo& operator=(ExtBattleInfo&& other) noexcept = default;
         ~ExtBattleInfo() override = default;
 
         // Getters
-        vector<vector<char>> getGameboard() const;
-        vector<pair<int,int>> getShellsLocation() const;
+        const vector<vector<char>>& getGameboard() const;
+        const vector<pair<int,int>>& getShellsLocation() const;
+        vector<vector<char>> takeGameboard(); // Move the board out, leaving it empty
+        vector<pair<int,int>> takeShellsLocation(); // Move the shells out, leaving them empty
         int getTankIndex() const;
         int getCurrAmmo() const;
         int getInitialAmmo() const;
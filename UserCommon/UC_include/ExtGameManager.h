@@ -0,0 +1,42 @@
+#pragma once
+
+# include "../../common/AbstractGameManager.h"
+# include "GameManagerOptions.h"
+# include <vector>
+
+namespace UserCommon_209277367_322542887 {
+
+// Time-budget outcome of a game, per player (index 0 = player 1)
+struct BudgetReport {
+    size_t overruns[2] = {0, 0}; // getAction calls over the per-call budget, played as DoNothing
+    bool forfeited[2] = {false, false}; // The player went over its per-game budget and lost
+};
+
+// AbstractGameManager with our engine extensions. The Simulator reaches it with a dynamic_cast,
+// so GameManagers that only implement the common interface keep working unchanged.
+class ExtGameManager : public AbstractGameManager {
+    public:
+        ~ExtGameManager() override = default; // Default destructor
+
+        // Set engine options, must be called before run()
+        virtual void setOptions(const GameManagerOptions& options) = 0;
+
+        // Time-budget outcome of the last run()
+        virtual BudgetReport getBudgetReport() const = 0;
+
+        // Steppable game, run() is init() followed by step() until finished() and then result().
+        // The players and the factories' targets must outlive the game; the map is only read by init().
+        virtual bool init(size_t map_width, size_t map_height, const SatelliteView& map, string map_name,
+            size_t max_steps, size_t num_shells, Player& player1, string name1, Player& player2, string name2,
+            TankAlgorithmFactory player1_tank_algo_factory, TankAlgorithmFactory player2_tank_algo_factory) = 0;
+        virtual bool step(size_t turns) = 0; // Play up to turns turns, false once the game is finished
+        virtual bool finished() const = 0; // Whether the game has ended
+        virtual GameResult result() = 0; // Move the result out, once finished
+
+        // Reuse: run() and init() may be called again on the same instance for the next game. Once a game
+        // is finished, its tank algorithms can be taken back (player 1 or 2, in tank order) to be reset
+        // and handed out again by the next game's factory.
+        virtual std::vector<unique_ptr<TankAlgorithm>> releaseTankAlgorithms(int player) = 0;
+};
+
+} // namespace UserCommon_209277367_322542887
\ No newline at end of file
@@ -1,6 +1,9 @@
 #pragma once
 
 # include "../../common/SatelliteView.h"
+# include "BoardImage.h"
+# include "TiledBoard.h"
+# include <span>
 # include <vector>
 
 using std::vector;
@@ -10,19 +13,30 @@ namespace UserCommon_209277367_322542887 {
 class ExtSatelliteView final : public SatelliteView {
     size_t width_;
     size_t height_;
-    vector<vector<char>> map_;
+    BoardImage image_; // Shared immutable cells
 
     public:
         // Rule of 5
-        ExtSatelliteView(size_t width, size_t height, vector<vector<char>> map);
+        ExtSatelliteView(size_t width, size_t height, const vector<vector<char>>& map);
+        ExtSatelliteView(size_t width, size_t height, vector<char> map); // Row-major board
+        explicit ExtSatelliteView(TiledBoard board); // Tiled board, kept tiled
+        explicit ExtSatelliteView(BoardImage image); // Shares the image's cells
         ~ExtSatelliteView() override = default; // Default destructor
-        ExtSatelliteView(const ExtSatelliteView&) = delete;
-        ExtSatelliteView& operator=(const ExtSatelliteView&) = delete;
-        ExtSatelliteView(ExtSatelliteView&&) noexcept = delete;
-        ExtSatelliteView& operator=(ExtSatelliteView&&) noexcept = delete;
+        ExtSatelliteView(const ExtSatelliteView&) = default; // Shares the cells
+        ExtSatelliteView& operator=(const ExtSatelliteView&) = default; // Shares the cells
+        ExtSatelliteView(ExtSatelliteView&& other) noexcept; // Leaves other an empty 0x0 view
+        ExtSatelliteView& operator=(ExtSatelliteView&& other) noexcept; // Leaves other an empty 0x0 view
 
         // API function to get an object at a specific location
         char getObjectAt(size_t x, size_t y) const override;
+
+        // Bulk access (see ViewAccess.h)
+        size_t getWidth() const { return width_; }
+        size_t getHeight() const { return height_; }
+        const BoardImage& getImage() const { return image_; } // Cells behind the view
+        const char* getRawBuffer() const { return image_.data(); } // Row-major cells, nullptr if tiled
+        std::span<const char> getRow(size_t y) const; // Row y (y < height), empty if tiled
+        void copyRow(size_t y, char* out) const { image_.copyRow(y, out); } // Row y (y < height), any storage
 };
 
-} // namespace UserCommon_209277367_322542887
\ No newline at end of file
+} // namespace UserCommon_209277367_322542887
@@ -0,0 +1,29 @@
+#pragma once
+
+# include <cstddef>
+# include <string>
+
+namespace UserCommon_209277367_322542887 {
+
+// How shells are advanced each half-step
+enum class ShellEngine {
+    Stepwise, // Every shell is moved and resolved one by one, in order
+    Event,    // Only shells that interact with something are resolved in order, the rest move in bulk
+    Banded    // Event, with the bulk work split into horizontal board bands run on worker threads
+};
+
+// Engine options the Simulator can hand to our GameManager (see ExtGameManager)
+struct GameManagerOptions {
+    ShellEngine shellEngine = ShellEngine::Stepwise;
+    size_t shellBands = 0; // Bands of the banded engine (0 = one per worker thread, on large boards with many shells)
+    std::string replayFolder; // Record a binary replay of every game into this folder (empty = off)
+    size_t replayKeyframeInterval = 64; // Turns between two full keyframes in a replay
+    std::string statsFolder; // Write per-phase timings and counters of every game into this folder (empty = off)
+    // Budgets are wall clock and checked when a call returns: a call that never returns is not caught
+    size_t actionBudgetMs = 0; // Longest a getAction call may take before it counts as DoNothing (0 = no limit)
+    size_t gameBudgetMs = 0; // Total algorithm time a player may use in one game before it forfeits (0 = no limit)
+    bool parallelActions = false; // Collect getAction() of all tanks on a worker pool (needs ThreadSafeTankAlgorithm)
+    bool cycleDetection = false; // Skip whole cycles once the state repeats (needs StatelessTankAlgorithm, off with verbose logging)
+};
+
+} // namespace UserCommon_209277367_322542887
\ No newline at end of file
@@ -0,0 +1,24 @@
+#pragma once
+
+# include <cstddef>
+
+namespace UserCommon_209277367_322542887 {
+
+// Players that can play another game. The Simulator keeps such a player once its game is over and,
+// instead of creating a new one, calls reset() with the arguments the player factory would get.
+// Afterwards the player must behave exactly like a newly created one; it may keep buffer capacity.
+class ResettablePlayer {
+    public:
+        virtual ~ResettablePlayer() = default; // Default destructor
+        virtual void reset(int player_index, size_t x, size_t y, size_t max_steps, size_t num_shells) = 0;
+};
+
+// Tank algorithms that can play another game, under the same contract as ResettablePlayer: reset()
+// gets the tank algorithm factory's arguments and leaves the instance as good as new.
+class ResettableTankAlgorithm {
+    public:
+        virtual ~ResettableTankAlgorithm() = default; // Default destructor
+        virtual void reset(int player_index, int tank_index) = 0;
+};
+
+} // namespace UserCommon_209277367_322542887
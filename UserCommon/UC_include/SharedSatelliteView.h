@@ -0,0 +1,40 @@
+#pragma once
+
+# include "../../common/SatelliteView.h"
+# include <span>
+# include <vector>
+
+using std::vector;
+
+namespace UserCommon_209277367_322542887 {
+
+// Read-only view over a board owned by someone else (row-major, index = y * width + x).
+// The requesting tank's cell is reported as '%' without touching the shared board.
+// The view must not outlive the board it references.
+class SharedSatelliteView final : public SatelliteView {
+    size_t width_;
+    size_t height_;
+    const char* map_; // Shared row-major board, not owned
+    size_t tankCell_; // Cell reported as '%'
+
+    public:
+        // Rule of 5
+        SharedSatelliteView(size_t width, size_t height, const char* map, size_t tank_x, size_t tank_y);
+        ~SharedSatelliteView() override = default; // Default destructor
+        SharedSatelliteView(const SharedSatelliteView&) = delete;
+        SharedSatelliteView& operator=(const SharedSatelliteView&) = delete;
+        SharedSatelliteView(SharedSatelliteView&&) noexcept = delete;
+        SharedSatelliteView& operator=(SharedSatelliteView&&) noexcept = delete;
+
+        // API function to get an object at a specific location
+        char getObjectAt(size_t x, size_t y) const override;
+
+        // Bulk access (see ViewAccess.h); rows and buffer show the tank's cell as stored, not as '%'
+        size_t getWidth() const { return width_; }
+        size_t getHeight() const { return height_; }
+        const char* getRawBuffer() const { return map_; } // Row-major shared board
+        std::span<const char> getRow(size_t y) const { return {map_ + y * width_, width_}; } // Row y, y < height
+        size_t getSelfCell() const { return tankCell_; } // Cell reported as '%' (y * width + x)
+};
+
+} // namespace UserCommon_209277367_322542887
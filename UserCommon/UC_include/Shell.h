@@ -6,6 +6,7 @@ using std::pair;
 
 namespace UserCommon_209277367_322542887 {
 
+// Plain value, copyable and movable, so shells can be stored contiguously
 class Shell {
         pair<int, int> location_;
         Direction direction_;
@@ -14,10 +15,10 @@ class Shell {
     public:
         Shell(int x, int y, Direction dir);
         Shell(const pair<int, int>& loc, Direction dir);
-        Shell(const Shell&) = delete; // Copy constructor
-        Shell& operator=(const Shell&) = delete; // Copy assignment
-        Shell(Shell&&) noexcept = delete; // Move constructor
-        Shell& operator=(Shell&&) noexcept = delete; // Move assignment
+        Shell(const Shell&) = default; // Copy constructor
+        Shell& operator=(const Shell&) = default; // Copy assignment
+        Shell(Shell&&) noexcept = default; // Move constructor
+        Shell& operator=(Shell&&) noexcept = default; // Move assignment
         ~Shell() = default;
         
         pair<int, int> getLocation() const;
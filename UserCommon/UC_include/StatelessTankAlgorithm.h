@@ -0,0 +1,15 @@
+#pragma once
+
+namespace UserCommon_209277367_322542887 {
+
+// Marker for tank algorithms that keep no state between calls: getAction() depends only on the
+// instance's construction arguments, never on earlier calls or on the battle info it was given.
+// A game whose tanks all behave like that repeats forever once its state repeats, so our
+// GameManager only skips cycles (GameManagerOptions::cycleDetection) when every tank's algorithm
+// derives from it. Algorithms that queue actions, count cooldowns or remember boards must not.
+class StatelessTankAlgorithm {
+    public:
+        virtual ~StatelessTankAlgorithm() = default; // Default destructor
+};
+
+} // namespace UserCommon_209277367_322542887
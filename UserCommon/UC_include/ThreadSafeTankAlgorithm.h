@@ -0,0 +1,13 @@
+#pragma once
+
+namespace UserCommon_209277367_322542887 {
+
+// Marker for tank algorithms whose instances share no mutable state, so getAction() may run on
+// several instances at once from different threads. Our GameManager only collects actions in
+// parallel (GameManagerOptions::parallelActions) when every tank's algorithm derives from it.
+class ThreadSafeTankAlgorithm {
+    public:
+        virtual ~ThreadSafeTankAlgorithm() = default; // Default destructor
+};
+
+} // namespace UserCommon_209277367_322542887
@@ -0,0 +1,51 @@
+#pragma once
+
+# include <array>
+# include <cstddef>
+# include <memory>
+# include <vector>
+
+using std::vector, std::shared_ptr;
+
+namespace UserCommon_209277367_322542887 {
+
+// Board of chars split into 64x64 tiles. Tiles that only hold the fill char all point to one
+// shared tile, and a shared tile is copied the first time one of its cells is written, so an
+// open-field map costs a pointer per tile instead of a byte per cell. Sizes are size_t throughout.
+class TiledBoard {
+public:
+    static constexpr size_t kTileShift = 6; // log2 of the tile side
+    static constexpr size_t kTileSide = size_t{1} << kTileShift; // Cells per tile row
+    static constexpr size_t kTileCells = kTileSide * kTileSide; // Cells per tile
+
+    TiledBoard() = default; // Empty board
+    TiledBoard(size_t width, size_t height, char fill = ' '); // Every cell holds fill
+
+    size_t getWidth() const { return width_; }
+    size_t getHeight() const { return height_; }
+    char getFill() const { return fill_; }
+
+    // Cell at (x, y), which must be on the board
+    char get(size_t x, size_t y) const {
+        return (*tiles_[(y >> kTileShift) * tilesPerRow_ + (x >> kTileShift)])[((y & (kTileSide - 1)) << kTileShift) | (x & (kTileSide - 1))];
+    }
+    void set(size_t x, size_t y, char value); // Write a cell, copying its tile first if it is shared
+    void copyRow(size_t y, char* out) const; // Write row y (width chars) to out
+    void assignRow(size_t y, const char* row); // Overwrite row y from width chars
+
+    size_t getTileCount() const { return tiles_.size(); } // Tiles covering the board
+    size_t getOwnedTileCount() const; // Tiles held by this board alone
+
+private:
+    using Tile = std::array<char, kTileCells>;
+
+    Tile& ownTile(size_t tile); // Tile to write to, unshared first
+
+    size_t width_ = 0;
+    size_t height_ = 0;
+    size_t tilesPerRow_ = 0; // Tiles across the board
+    char fill_ = ' ';
+    vector<shared_ptr<Tile>> tiles_; // Row-major tiles, fill-only ones share one tile
+};
+
+} // namespace UserCommon_209277367_322542887
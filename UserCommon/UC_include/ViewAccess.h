@@ -0,0 +1,22 @@
+#pragma once
+
+# include "../../common/SatelliteView.h"
+# include <cstddef>
+# include <utility>
+# include <vector>
+
+using std::vector, std::pair;
+
+namespace UserCommon_209277367_322542887 {
+
+// Bulk reads of a SatelliteView. ExtSatelliteView and SharedSatelliteView are copied straight from
+// their buffers with memcpy (SharedSatelliteView's '%' put back in place); any other SatelliteView,
+// or a request that does not match the view's size, goes through getObjectAt cell by cell.
+
+void copyViewRow(const SatelliteView& view, size_t y, size_t width, char* out); // Row y, width cells
+void copyView(const SatelliteView& view, size_t width, size_t height, char* out); // Row-major width x height cells
+
+// Append (x, y) of every target char in a row of width cells, in order (memchr)
+void findInRow(const char* row, size_t width, size_t y, char target, vector<pair<int, int>>& found);
+
+} // namespace UserCommon_209277367_322542887
@@ -0,0 +1,57 @@
+# include "BoardImage.h"
+
+#include <cstring>
+#include <utility>
+
+namespace UserCommon_209277367_322542887 {
+
+// Takes a row-major buffer of width * height cells
+BoardImage::BoardImage(const size_t width, const size_t height, vector<char> cells)
+    : width_(width), height_(height) {
+    auto shared = std::make_shared<Cells>();
+    shared->dense = std::move(cells);
+    dense_ = shared->dense.data();
+    cells_ = std::move(shared);
+}
+
+// Rows of equal length, flattened once
+BoardImage::BoardImage(const vector<vector<char>>& rows)
+    : width_(rows.empty() ? 0 : rows.front().size()), height_(rows.size()) {
+    auto shared = std::make_shared<Cells>();
+    shared->dense.reserve(width_ * height_);
+    for (const auto& row : rows) { shared->dense.insert(shared->dense.end(), row.begin(), row.end()); }
+    dense_ = shared->dense.data();
+    cells_ = std::move(shared);
+}
+
+// Keeps the tiles (and whatever they share) as they are
+BoardImage::BoardImage(TiledBoard board)
+    : width_(board.getWidth()), height_(board.getHeight()) {
+    auto shared = std::make_shared<Cells>();
+    shared->tiles = std::move(board);
+    tiled_ = &shared->tiles;
+    cells_ = std::move(shared);
+}
+
+// Write row y (width chars) to out
+void BoardImage::copyRow(const size_t y, char* out) const {
+    if (dense_) { std::memcpy(out, dense_ + y * width_, width_); }
+    else { tiled_->copyRow(y, out); }
+}
+
+// Same size and cells; images sharing their cells are equal without a look
+bool BoardImage::operator==(const BoardImage& other) const {
+    if (width_ != other.width_ || height_ != other.height_) { return false; }
+    if (cells_ == other.cells_ || empty()) { return true; }
+    if (dense_ && other.dense_) { return std::memcmp(dense_, other.dense_, width_ * height_) == 0; }
+
+    vector<char> row(width_), other_row(width_);
+    for (size_t y = 0; y < height_; ++y) {
+        copyRow(y, row.data());
+        other.copyRow(y, other_row.data());
+        if (row != other_row) { return false; }
+    }
+    return true;
+}
+
+} // namespace UserCommon_209277367_322542887
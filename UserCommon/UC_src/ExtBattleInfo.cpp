@@ -5,15 +5,19 @@
 namespace UserCommon_209277367_322542887 {
 
 // Constructor
-ExtBattleInfo::ExtBattleInfo(const vector<vector<char>>& gameboard, const vector<pair<int,int>>& shells_location,
+ExtBattleInfo::ExtBattleInfo(vector<vector<char>> gameboard, vector<pair<int,int>> shells_location,
     const int num_shells, pair<int, int> initial_loc)
-    : currGameboard_(gameboard), shellLocations_(shells_location), initialLoc_(std::move(initial_loc)), initialAmmo_(num_shells),
-        tankIndex_(0), currAmmo_(0) {} // Updated to move semantics for initial loc
+    : currGameboard_(std::move(gameboard)), shellLocations_(std::move(shells_location)), initialLoc_(std::move(initial_loc)),
+        initialAmmo_(num_shells), tankIndex_(0), currAmmo_(0) {}
 
 // Getters
-vector<vector<char>> ExtBattleInfo::getGameboard() const{ return currGameboard_; }
+const vector<vector<char>>& ExtBattleInfo::getGameboard() const{ return currGameboard_; }
 
-vector<pair<int,int>> ExtBattleInfo::getShellsLocation() const{ return shellLocations_; }
+const vector<pair<int,int>>& ExtBattleInfo::getShellsLocation() const{ return shellLocations_; }
+
+vector<vector<char>> ExtBattleInfo::takeGameboard() { return std::exchange(currGameboard_, {}); }
+
+vector<pair<int,int>> ExtBattleInfo::takeShellsLocation() { return std::exchange(shellLocations_, {}); }
 
 int ExtBattleInfo::getCurrAmmo() const { return currAmmo_; }
 
@@ -4,17 +4,48 @@
 
 namespace UserCommon_209277367_322542887 {
 
-// Constructor
-ExtSatelliteView::ExtSatelliteView(const size_t width, const size_t height, vector<vector<char>> map)
-    : width_(width), height_(height), map_(std::move(map)) {}
+// Constructor from a 2D board, flattened row by row
+ExtSatelliteView::ExtSatelliteView(const size_t width, const size_t height, const vector<vector<char>>& map)
+    : width_(width), height_(height), image_(map) {}
+
+// Constructor from a row-major board
+ExtSatelliteView::ExtSatelliteView(const size_t width, const size_t height, vector<char> map)
+    : width_(width), height_(height), image_(width, height, std::move(map)) {}
+
+// Constructor from a tiled board, which stays tiled (large, mostly empty maps)
+ExtSatelliteView::ExtSatelliteView(TiledBoard board)
+    : width_(board.getWidth()), height_(board.getHeight()), image_(std::move(board)) {}
+
+// Constructor sharing an existing image
+ExtSatelliteView::ExtSatelliteView(BoardImage image)
+    : width_(image.getWidth()), height_(image.getHeight()), image_(std::move(image)) {}
+
+// Move constructor, the moved-from view is empty
+ExtSatelliteView::ExtSatelliteView(ExtSatelliteView&& other) noexcept
+    : width_(std::exchange(other.width_, 0)), height_(std::exchange(other.height_, 0)), image_(std::exchange(other.image_, {})) {}
+
+// Move assignment, the moved-from view is empty
+ExtSatelliteView& ExtSatelliteView::operator=(ExtSatelliteView&& other) noexcept {
+    width_ = std::exchange(other.width_, 0);
+    height_ = std::exchange(other.height_, 0);
+    image_ = std::exchange(other.image_, {});
+    return *this;
+}
 
 // Function to retrieve an object at a given location
 char ExtSatelliteView::getObjectAt(const size_t x, const size_t y) const {
     if (x < width_ && y < height_) {
-        return map_[y][x];
+        return image_.at(x, y);
     }
 
     return '&'; // Return a space character if out of bounds
 }
 
-} // namespace UserCommon_209277367_322542887
\ No newline at end of file
+// Contiguous row y, or an empty span when the cells are tiled
+std::span<const char> ExtSatelliteView::getRow(const size_t y) const {
+    const char* cells = image_.data();
+    if (!cells) { return {}; }
+    return {cells + y * width_, width_};
+}
+
+} // namespace UserCommon_209277367_322542887
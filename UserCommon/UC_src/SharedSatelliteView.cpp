@@ -0,0 +1,20 @@
+# include "SharedSatelliteView.h"
+
+namespace UserCommon_209277367_322542887 {
+
+// Constructor referencing a shared row-major board with the tank at (tank_x, tank_y)
+SharedSatelliteView::SharedSatelliteView(const size_t width, const size_t height, const char* map,
+        const size_t tank_x, const size_t tank_y)
+    : width_(width), height_(height), map_(map), tankCell_(tank_y * width + tank_x) {}
+
+// Function to retrieve an object at a given location
+char SharedSatelliteView::getObjectAt(const size_t x, const size_t y) const {
+    if (x < width_ && y < height_) {
+        const size_t cell = y * width_ + x;
+        return (cell == tankCell_) ? '%' : map_[cell];
+    }
+
+    return '&'; // Out of bounds
+}
+
+} // namespace UserCommon_209277367_322542887
@@ -0,0 +1,60 @@
+# include "TiledBoard.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace UserCommon_209277367_322542887 {
+
+// Every tile starts as the same fill-only tile
+TiledBoard::TiledBoard(const size_t width, const size_t height, const char fill)
+    : width_(width), height_(height), tilesPerRow_((width + kTileSide - 1) >> kTileShift), fill_(fill) {
+    const size_t tile_rows = (height + kTileSide - 1) >> kTileShift;
+    if (tilesPerRow_ == 0 || tile_rows == 0) { return; }
+
+    auto blank = std::make_shared<Tile>();
+    blank->fill(fill);
+    tiles_.assign(tilesPerRow_ * tile_rows, blank);
+}
+
+// Tile to write to, copied first if anyone else holds it
+TiledBoard::Tile& TiledBoard::ownTile(const size_t tile) {
+    shared_ptr<Tile>& slot = tiles_[tile];
+    if (slot.use_count() > 1) { slot = std::make_shared<Tile>(*slot); }
+    return *slot;
+}
+
+// Write a cell; writing the value it already holds never copies a tile
+void TiledBoard::set(const size_t x, const size_t y, const char value) {
+    if (get(x, y) == value) { return; }
+    ownTile((y >> kTileShift) * tilesPerRow_ + (x >> kTileShift))
+        [((y & (kTileSide - 1)) << kTileShift) | (x & (kTileSide - 1))] = value;
+}
+
+// Write row y (width chars) to out, one tile segment at a time
+void TiledBoard::copyRow(const size_t y, char* out) const {
+    const size_t base = (y >> kTileShift) * tilesPerRow_;
+    const size_t offset = (y & (kTileSide - 1)) << kTileShift;
+    for (size_t x = 0; x < width_; x += kTileSide) {
+        std::memcpy(out + x, tiles_[base + (x >> kTileShift)]->data() + offset, std::min(kTileSide, width_ - x));
+    }
+}
+
+// Overwrite row y from width chars; segments that are all fill leave shared tiles alone
+void TiledBoard::assignRow(const size_t y, const char* row) {
+    const size_t base = (y >> kTileShift) * tilesPerRow_;
+    const size_t offset = (y & (kTileSide - 1)) << kTileShift;
+    for (size_t x = 0; x < width_; x += kTileSide) {
+        const size_t length = std::min(kTileSide, width_ - x);
+        const char* current = tiles_[base + (x >> kTileShift)]->data() + offset;
+        if (std::memcmp(current, row + x, length) == 0) { continue; }
+        std::memcpy(ownTile(base + (x >> kTileShift)).data() + offset, row + x, length);
+    }
+}
+
+// Tiles held by this board alone
+size_t TiledBoard::getOwnedTileCount() const {
+    return static_cast<size_t>(std::count_if(tiles_.begin(), tiles_.end(),
+        [](const shared_ptr<Tile>& tile) { return tile.use_count() == 1; }));
+}
+
+} // namespace UserCommon_209277367_322542887
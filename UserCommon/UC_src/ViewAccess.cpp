@@ -0,0 +1,61 @@
+# include "ViewAccess.h"
+# include "ExtSatelliteView.h"
+# include "SharedSatelliteView.h"
+
+#include <cstring>
+
+namespace UserCommon_209277367_322542887 {
+
+namespace {
+
+// Row y through getObjectAt, for views of unknown type
+void copyRowSlow(const SatelliteView& view, const size_t y, const size_t width, char* out) {
+    for (size_t x = 0; x < width; ++x) { out[x] = view.getObjectAt(x, y); }
+}
+
+} // namespace
+
+// Row y, width cells
+void copyViewRow(const SatelliteView& view, const size_t y, const size_t width, char* out) {
+    if (const auto* ext = dynamic_cast<const ExtSatelliteView*>(&view)) {
+        if (width == ext->getWidth() && y < ext->getHeight()) { ext->copyRow(y, out); return; }
+    } else if (const auto* shared = dynamic_cast<const SharedSatelliteView*>(&view)) {
+        if (width == shared->getWidth() && y < shared->getHeight()) {
+            std::memcpy(out, shared->getRow(y).data(), width);
+            const size_t self = shared->getSelfCell();
+            if (self / width == y) { out[self % width] = '%'; }
+            return;
+        }
+    }
+    copyRowSlow(view, y, width, out);
+}
+
+// Row-major width x height cells; a dense known view is a single memcpy
+void copyView(const SatelliteView& view, const size_t width, const size_t height, char* out) {
+    if (const auto* ext = dynamic_cast<const ExtSatelliteView*>(&view)) {
+        if (width == ext->getWidth() && height == ext->getHeight()) {
+            if (const char* cells = ext->getRawBuffer()) { std::memcpy(out, cells, width * height); }
+            else { for (size_t y = 0; y < height; ++y) { ext->copyRow(y, out + y * width); } }
+            return;
+        }
+    } else if (const auto* shared = dynamic_cast<const SharedSatelliteView*>(&view)) {
+        if (width == shared->getWidth() && height == shared->getHeight()) {
+            std::memcpy(out, shared->getRawBuffer(), width * height);
+            if (shared->getSelfCell() < width * height) { out[shared->getSelfCell()] = '%'; }
+            return;
+        }
+    }
+    for (size_t y = 0; y < height; ++y) { copyRowSlow(view, y, width, out + y * width); }
+}
+
+// Append (x, y) of every target char in a row, in order
+void findInRow(const char* row, const size_t width, const size_t y, const char target, vector<pair<int, int>>& found) {
+    const char* end = row + width;
+    for (const char* p = row; p < end; ++p) {
+        p = static_cast<const char*>(std::memchr(p, target, static_cast<size_t>(end - p)));
+        if (!p) { return; }
+        found.emplace_back(static_cast<int>(p - row), static_cast<int>(y));
+    }
+}
+
+} // namespace UserCommon_209277367_322542887
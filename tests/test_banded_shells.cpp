@@ -0,0 +1,51 @@
+#include "./utils/gm_utils.test.cpp"
+
+namespace {
+GameManagerOptions banded(const size_t bands) {
+    GameManagerOptions options;
+    options.shellEngine = ShellEngine::Banded;
+    options.shellBands = bands;
+    return options;
+}
+
+GameManagerOptions engine(const ShellEngine shell_engine) {
+    GameManagerOptions options;
+    options.shellEngine = shell_engine;
+    return options;
+}
+
+const TankAlgorithmFactory triggerHappy = randomTanks(0, 7); // Shoots every other turn on average
+} // namespace
+
+// ------- banded games match the stepwise engine turn by turn -------
+TEST(BandedShells, MatchesStepwiseForAnyBandCount) {
+    const size_t width = 70, height = 45;
+    const vector<char> cells = randomMap(width, height, 4, 6, 3);
+    const PlayedGame stepwise = play(width, height, cells, engine(ShellEngine::Stepwise), triggerHappy);
+    EXPECT_GT(stepwise.hashes.size(), 20u); // The game did play
+
+    for (const size_t bands : {2, 3, 7, 45}) { // 45 bands of one row each
+        SCOPED_TRACE(bands);
+        expectSameGame(play(width, height, cells, banded(bands), triggerHappy), stepwise);
+    }
+}
+
+TEST(BandedShells, MatchesStepwiseOnRandomBoards) {
+    std::mt19937 rng(17);
+    for (int game = 0; game < 8; ++game) {
+        const size_t width = 8 + rng() % 60, height = 8 + rng() % 60;
+        const vector<char> cells = randomMap(width, height, 4, 2 + rng() % 8, rng());
+        SCOPED_TRACE(testing::Message() << "game " << game << " (" << width << "x" << height << ")");
+        expectSameGame(play(width, height, cells, banded(2 + rng() % 6), triggerHappy),
+                       play(width, height, cells, engine(ShellEngine::Stepwise), triggerHappy));
+    }
+}
+
+// ------- automatic bands: large open board, thousands of shells -------
+TEST(BandedShells, AutomaticBandsMatchStepwiseOnALargeBoard) {
+    const size_t width = 500, height = 400;
+    const vector<char> cells = randomMap(width, height, 0, 1, 29);
+    const PlayedGame stepwise = play(width, height, cells, engine(ShellEngine::Stepwise), triggerHappy);
+    expectSameGame(play(width, height, cells, banded(0), triggerHappy), stepwise);
+    expectSameGame(play(width, height, cells, engine(ShellEngine::Event), triggerHappy), stepwise); // Same replay of head-on rewinds
+}
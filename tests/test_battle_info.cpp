@@ -0,0 +1,141 @@
+#include "./utils/gm_utils.test.cpp"
+#include "SharedSatelliteView.h"
+#include <algorithm>
+#include <set>
+
+namespace {
+// A random tank that asks for battle info every third turn
+class CuriousTank : public RandomTank {
+public:
+    CuriousTank(uint32_t seed, unsigned shots) : RandomTank(seed, shots) {}
+    ActionRequest getAction() override {
+        const ActionRequest action = RandomTank::getAction(); // Keeps the random sequence the same every turn
+        return ++turns_ % 3 == 0 ? ActionRequest::GetBattleInfo : action;
+    }
+private:
+    unsigned turns_ = 0;
+};
+
+// What one GetBattleInfo request saw
+struct SeenView {
+    int player;
+    vector<char> cells; // Row-major copy of the view
+};
+
+// Copies every view it is handed
+class RecordingPlayer : public Player {
+public:
+    RecordingPlayer(int player, size_t width, size_t height, vector<SeenView>& seen)
+        : player_(player), width_(width), height_(height), seen_(seen) {}
+    void updateTankWithBattleInfo(TankAlgorithm&, SatelliteView& view) override {
+        SeenView copy{player_, vector<char>(width_ * height_)};
+        for (size_t y = 0; y < height_; ++y) {
+            for (size_t x = 0; x < width_; ++x) copy.cells[y * width_ + x] = view.getObjectAt(x, y);
+        }
+        seen_.push_back(std::move(copy));
+    }
+private:
+    int player_;
+    size_t width_, height_;
+    vector<SeenView>& seen_;
+};
+
+// Always asks for battle info
+class AskingTank : public TankAlgorithm {
+public:
+    ActionRequest getAction() override { return ActionRequest::GetBattleInfo; }
+    void updateBattleInfo(BattleInfo&) override {}
+};
+
+// Keeps what each view points at, without copying it
+class ViewInspector : public Player {
+public:
+    struct Seen {
+        const char* board; // Shared buffer behind the view
+        size_t self; // Cell reported as '%'
+        char stored; // What the buffer holds at that cell
+        char shown; // What the view reports there
+        char outside; // What the view reports past the board
+    };
+    explicit ViewInspector(vector<Seen>& seen) : seen_(seen) {}
+    void updateTankWithBattleInfo(TankAlgorithm&, SatelliteView& view) override {
+        const auto* shared = dynamic_cast<const SharedSatelliteView*>(&view);
+        ASSERT_NE(shared, nullptr);
+        const size_t self = shared->getSelfCell(), width = shared->getWidth();
+        seen_.push_back({shared->getRawBuffer(), self, shared->getRawBuffer()[self], view.getObjectAt(self % width, self / width),
+                         view.getObjectAt(width, 0)});
+    }
+private:
+    vector<Seen>& seen_;
+};
+
+// Plays a game of curious tanks, checking every turn's views against the board saved before the turn
+void expectViewsOfTheTurnStart(const size_t width, const size_t height, const vector<char>& cells, const uint32_t seed) {
+    vector<SeenView> seen;
+    RecordingPlayer player1(1, width, height, seen), player2(2, width, height, seen);
+    auto factory = [seed](int player, int tank) {
+        return std::make_unique<CuriousTank>(seed + static_cast<uint32_t>(player * 7919 + tank), 4);
+    };
+    ExtSatelliteView map(width, height, cells);
+    GM_209277367_322542887 gm(false);
+    ASSERT_TRUE(gm.init(width, height, map, "map", 150, 30, player1, "p1", player2, "p2", factory, factory));
+
+    size_t views = 0;
+    GameSnapshot start;
+    for (gm.snapshot(start); gm.step(1); gm.snapshot(start)) {
+        for (const SeenView& view : seen) {
+            ASSERT_EQ(std::count(view.cells.begin(), view.cells.end(), '%'), 1) << "turn " << start.turn;
+            const size_t self = static_cast<size_t>(std::find(view.cells.begin(), view.cells.end(), '%') - view.cells.begin());
+            EXPECT_EQ(start.board[self], static_cast<char>('0' + view.player)) << "turn " << start.turn; // Its own tank
+            vector<char> board = view.cells;
+            board[self] = start.board[self];
+            const auto diff = std::mismatch(board.begin(), board.end(), start.board.begin()).first - board.begin();
+            ASSERT_EQ(diff, static_cast<ptrdiff_t>(board.size())) << "turn " << start.turn << ", cell " << diff;
+        }
+        views += seen.size();
+        seen.clear();
+    }
+    EXPECT_GT(views, 20u); // Tanks did ask
+}
+} // namespace
+
+// ------- battle info shows the board as it was when the turn started -------
+TEST(BattleInfo, ViewIsTheBoardAtTheStartOfTheTurn) {
+    std::mt19937 rng(41);
+    for (int game = 0; game < 8; ++game) {
+        const size_t width = 6 + rng() % 30, height = 6 + rng() % 30;
+        SCOPED_TRACE(testing::Message() << "game " << game << " (" << width << "x" << height << ")");
+        expectViewsOfTheTurnStart(width, height, randomMap(width, height, 10, 4, rng()), rng());
+    }
+}
+
+// ------- every request of a turn reads one shared board, with '%' overlaid, not written -------
+TEST(BattleInfo, RequestsOfATurnShareOneBoard) {
+    const vector<char> cells = mapOf({
+        "#########",
+        "#1  2  1#",
+        "#  2  1 #",
+        "#########",
+    });
+    vector<ViewInspector::Seen> seen;
+    ViewInspector player1(seen), player2(seen);
+    auto factory = [](int, int) { return std::make_unique<AskingTank>(); };
+    ExtSatelliteView map(9, 4, cells);
+    GM_209277367_322542887 gm(false);
+    ASSERT_TRUE(gm.init(9, 4, map, "map", 20, 5, player1, "p1", player2, "p2", factory, factory));
+
+    for (int turn = 0; turn < 3; ++turn) {
+        seen.clear();
+        ASSERT_TRUE(gm.step(1));
+        ASSERT_EQ(seen.size(), 5u); // Every tank asked
+        std::set<size_t> selves;
+        for (const auto& view : seen) {
+            EXPECT_EQ(view.board, seen.front().board); // One board for the whole turn
+            EXPECT_EQ(view.shown, '%');
+            EXPECT_TRUE(view.stored == '1' || view.stored == '2'); // The '%' lives in the view only
+            EXPECT_EQ(view.outside, '&');
+            selves.insert(view.self);
+        }
+        EXPECT_EQ(selves.size(), seen.size()); // Each tank sees itself
+    }
+}
@@ -0,0 +1,46 @@
+#include "BoardImage.h"
+#include "ExtSatelliteView.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace UserCommon_209277367_322542887;
+
+// ------- copies share cells, the buffer is taken by move -------
+TEST(BoardImage, CopiesShareTheMovedBuffer) {
+    std::vector<char> cells = {'#', ' ', '1', '@', '2', ' '};
+    const char* buffer = cells.data();
+    const BoardImage image(3, 2, std::move(cells));
+    const BoardImage copy = image;
+
+    EXPECT_EQ(image.data(), buffer);
+    EXPECT_EQ(copy.data(), buffer);
+    EXPECT_EQ(copy.at(2, 0), '1');
+    EXPECT_EQ(copy.at(1, 1), '2');
+
+    const ExtSatelliteView view(copy);
+    EXPECT_EQ(view.getImage().data(), buffer);
+    EXPECT_EQ(view.getObjectAt(0, 1), '@');
+    EXPECT_EQ(view.getObjectAt(3, 0), '&');
+}
+
+// ------- dense and tiled images compare by content -------
+TEST(BoardImage, DenseAndTiledImagesCompareByContent) {
+    const std::vector<std::vector<char>> rows = {{' ', '#', ' '}, {'2', ' ', '$'}};
+    TiledBoard tiles(3, 2);
+    tiles.set(1, 0, '#');
+    tiles.set(0, 1, '2');
+    tiles.set(2, 1, '$');
+
+    const BoardImage dense(rows);
+    const BoardImage tiled(std::move(tiles));
+    EXPECT_EQ(tiled.data(), nullptr);
+    EXPECT_TRUE(dense == tiled);
+
+    std::string row(3, '?');
+    tiled.copyRow(1, row.data());
+    EXPECT_EQ(row, "2 $");
+
+    const BoardImage other(3, 2, {' ', '#', ' ', '2', ' ', '#'});
+    EXPECT_FALSE(dense == other);
+}
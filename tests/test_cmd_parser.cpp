@@ -263,6 +263,203 @@ TEST(CmdParserTest, NumThreadsRejectsZeroNegativeAndJunk) {
     EXPECT_FALSE(rj.valid);
 }
 
+// ---------------- GameManager options ----------------
+
+TEST(CmdParserTest, ShellEngineDefaultsToStepwiseAndParsesEvent) {
+    TempDir t;
+    const fs::path mapsDir = t.path() / "maps";
+    const fs::path gmSo    = t.path() / "gm.so";
+    const fs::path algos   = t.path() / "algos";
+    fs::create_directories(mapsDir);
+    touch(mapsDir / "m1.map", "x");
+    fs::create_directories(algos);
+    touch(algos / "a1.so", "");
+    touch(gmSo, "");
+
+    using UserCommon_209277367_322542887::ShellEngine;
+
+    Argv a({
+        "-competition",
+        std::string("game_maps_folder=") + mapsDir.string(),
+        std::string("game_manager=") + gmSo.string(),
+        std::string("algorithms_folder=") + algos.string()
+    });
+    auto r = CmdParser::parse(a.argc(), a.argv());
+    EXPECT_TRUE(r.valid) << r.errorMessage;
+    EXPECT_EQ(r.gmOptions.shellEngine, ShellEngine::Stepwise);
+
+    Argv e({
+        "-competition",
+        std::string("game_maps_folder=") + mapsDir.string(),
+        std::string("game_manager=") + gmSo.string(),
+        std::string("algorithms_folder=") + algos.string(),
+        "shell_engine=event"
+    });
+    auto re = CmdParser::parse(e.argc(), e.argv());
+    EXPECT_TRUE(re.valid) << re.errorMessage;
+    EXPECT_EQ(re.gmOptions.shellEngine, ShellEngine::Event);
+
+    Argv b({
+        "-competition",
+        std::string("game_maps_folder=") + mapsDir.string(),
+        std::string("game_manager=") + gmSo.string(),
+        std::string("algorithms_folder=") + algos.string(),
+        "shell_engine=banded",
+        "shell_bands=6"
+    });
+    auto rb = CmdParser::parse(b.argc(), b.argv());
+    EXPECT_TRUE(rb.valid) << rb.errorMessage;
+    EXPECT_EQ(rb.gmOptions.shellEngine, ShellEngine::Banded);
+    EXPECT_EQ(rb.gmOptions.shellBands, 6u);
+}
+
+TEST(CmdParserTest, ShellEngineRejectsUnknownValue) {
+    Argv a({"-comparative", "algorithm1=a.so", "algorithm2=b.so", "game_map=m.map", "game_managers_folder=gm", "shell_engine=fast",
+            "shell_bands=-2"});
+    auto r = CmdParser::parse(a.argc(), a.argv());
+    EXPECT_FALSE(r.valid);
+    EXPECT_NE(r.errorMessage.find("Invalid value for shell_engine"), std::string::npos);
+    EXPECT_NE(r.errorMessage.find("Invalid value for shell_bands"), std::string::npos);
+}
+
+TEST(CmdParserTest, ReplayFolderMustBeAnExistingFolder) {
+    TempDir t;
+    const fs::path mapsDir = t.path() / "maps";
+    const fs::path gmSo    = t.path() / "gm.so";
+    const fs::path algos   = t.path() / "algos";
+    const fs::path replays = t.path() / "replays";
+    fs::create_directories(mapsDir);
+    touch(mapsDir / "m1.map", "x");
+    fs::create_directories(algos);
+    touch(algos / "a1.so", "");
+    touch(gmSo, "");
+    fs::create_directories(replays);
+
+    Argv a({
+        "-competition",
+        std::string("game_maps_folder=") + mapsDir.string(),
+        std::string("game_manager=") + gmSo.string(),
+        std::string("algorithms_folder=") + algos.string(),
+        std::string("replay_folder=") + replays.string()
+    });
+    auto r = CmdParser::parse(a.argc(), a.argv());
+    EXPECT_TRUE(r.valid) << r.errorMessage;
+    EXPECT_EQ(r.gmOptions.replayFolder, replays.string());
+
+    Argv m({
+        "-competition",
+        std::string("game_maps_folder=") + mapsDir.string(),
+        std::string("game_manager=") + gmSo.string(),
+        std::string("algorithms_folder=") + algos.string(),
+        std::string("replay_folder=") + (t.path() / "missing").string()
+    });
+    auto rm = CmdParser::parse(m.argc(), m.argv());
+    EXPECT_FALSE(rm.valid);
+    EXPECT_NE(rm.errorMessage.find("Invalid value for replay_folder"), std::string::npos);
+}
+
+TEST(CmdParserTest, StatsFolderMustBeAnExistingFolder) {
+    TempDir t;
+    Argv a({"-comparative", "algorithm1=a.so", "algorithm2=b.so", "game_map=m.map", "game_managers_folder=gm",
+            std::string("stats_folder=") + (t.path() / "missing").string()});
+    auto r = CmdParser::parse(a.argc(), a.argv());
+    EXPECT_FALSE(r.valid);
+    EXPECT_NE(r.errorMessage.find("Invalid value for stats_folder"), std::string::npos);
+
+    Argv ok({"-comparative", "algorithm1=a.so", "algorithm2=b.so", "game_map=m.map", "game_managers_folder=gm",
+             std::string("stats_folder=") + t.path().string()});
+    auto rok = CmdParser::parse(ok.argc(), ok.argv());
+    EXPECT_EQ(rok.errorMessage.find("stats_folder"), std::string::npos);
+}
+
+TEST(CmdParserTest, TimeBudgetsMustBeMilliseconds) {
+    Argv a({"-comparative", "algorithm1=a.so", "algorithm2=b.so", "game_map=m.map", "game_managers_folder=gm",
+            "action_budget_ms=5s", "game_budget_ms=-1"});
+    auto r = CmdParser::parse(a.argc(), a.argv());
+    EXPECT_FALSE(r.valid);
+    EXPECT_NE(r.errorMessage.find("Invalid value for action_budget_ms"), std::string::npos);
+    EXPECT_NE(r.errorMessage.find("Invalid value for game_budget_ms"), std::string::npos);
+
+    TempDir t;
+    const fs::path mapsDir = t.path() / "maps";
+    const fs::path gmSo    = t.path() / "gm.so";
+    const fs::path algos   = t.path() / "algos";
+    fs::create_directories(mapsDir);
+    touch(mapsDir / "m1.map", "x");
+    fs::create_directories(algos);
+    touch(algos / "a1.so", "");
+    touch(gmSo, "");
+
+    Argv ok({
+        "-competition",
+        std::string("game_maps_folder=") + mapsDir.string(),
+        std::string("game_manager=") + gmSo.string(),
+        std::string("algorithms_folder=") + algos.string(),
+        "action_budget_ms=50", "game_budget_ms=2000"
+    });
+    auto rok = CmdParser::parse(ok.argc(), ok.argv());
+    EXPECT_TRUE(rok.valid) << rok.errorMessage;
+    EXPECT_EQ(rok.gmOptions.actionBudgetMs, 50u);
+    EXPECT_EQ(rok.gmOptions.gameBudgetMs, 2000u);
+}
+
+TEST(CmdParserTest, CycleDetectionIsOptInAndRejectsUnknownValue) {
+    Argv a({"-comparative", "algorithm1=a.so", "algorithm2=b.so", "game_map=m.map", "game_managers_folder=gm", "cycle_detection=maybe"});
+    auto r = CmdParser::parse(a.argc(), a.argv());
+    EXPECT_FALSE(r.valid);
+    EXPECT_NE(r.errorMessage.find("Invalid value for cycle_detection"), std::string::npos);
+
+    TempDir t;
+    const fs::path mapsDir = t.path() / "maps";
+    const fs::path gmSo    = t.path() / "gm.so";
+    const fs::path algos   = t.path() / "algos";
+    fs::create_directories(mapsDir);
+    touch(mapsDir / "m1.map", "x");
+    fs::create_directories(algos);
+    touch(algos / "a1.so", "");
+    touch(gmSo, "");
+
+    Argv on({
+        "-competition",
+        std::string("game_maps_folder=") + mapsDir.string(),
+        std::string("game_manager=") + gmSo.string(),
+        std::string("algorithms_folder=") + algos.string(),
+        "cycle_detection=on"
+    });
+    auto ron = CmdParser::parse(on.argc(), on.argv());
+    EXPECT_TRUE(ron.valid) << ron.errorMessage;
+    EXPECT_TRUE(ron.gmOptions.cycleDetection);
+}
+
+TEST(CmdParserTest, ParallelActionsIsOptInAndRejectsUnknownValue) {
+    Argv a({"-comparative", "algorithm1=a.so", "algorithm2=b.so", "game_map=m.map", "game_managers_folder=gm", "parallel_actions=yes"});
+    auto r = CmdParser::parse(a.argc(), a.argv());
+    EXPECT_FALSE(r.valid);
+    EXPECT_NE(r.errorMessage.find("Invalid value for parallel_actions"), std::string::npos);
+
+    TempDir t;
+    const fs::path mapsDir = t.path() / "maps";
+    const fs::path gmSo    = t.path() / "gm.so";
+    const fs::path algos   = t.path() / "algos";
+    fs::create_directories(mapsDir);
+    touch(mapsDir / "m1.map", "x");
+    fs::create_directories(algos);
+    touch(algos / "a1.so", "");
+    touch(gmSo, "");
+
+    Argv on({
+        "-competition",
+        std::string("game_maps_folder=") + mapsDir.string(),
+        std::string("game_manager=") + gmSo.string(),
+        std::string("algorithms_folder=") + algos.string(),
+        "parallel_actions=on"
+    });
+    auto ron = CmdParser::parse(on.argc(), on.argv());
+    EXPECT_TRUE(ron.valid) << ron.errorMessage;
+    EXPECT_TRUE(ron.gmOptions.parallelActions);
+    EXPECT_FALSE(ron.gmOptions.cycleDetection);
+}
+
 // ---------------- Filesystem Validation ----------------
 
 TEST(CmdParserTest, FailsOnMissingOrInvalidPaths) {
@@ -29,7 +29,7 @@ static ComparativeSimulator::SnapshotGameResult mkResult(
     r.winner = winner;
     r.reason = GameResult::Reason(reason);
     r.rounds = rounds;
-    r.board  = std::move(boardRows);
+    r.board  = BoardImage(boardRows);
     r.remaining_tanks.clear(); // not used by these tests
     return r;
 }
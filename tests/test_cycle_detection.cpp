@@ -0,0 +1,151 @@
+#include "./utils/gm_utils.test.cpp"
+#include "StatelessTankAlgorithm.h"
+#include "Zobrist.h"
+
+#include <cstdio>
+#include <fstream>
+
+namespace {
+// Plays the same action every turn, whatever happened before
+class SameActionTank : public TankAlgorithm, public StatelessTankAlgorithm {
+public:
+    explicit SameActionTank(ActionRequest action) : action_(action) {}
+    ActionRequest getAction() override { return action_; }
+    void updateBattleInfo(BattleInfo&) override {}
+private:
+    ActionRequest action_;
+};
+
+// Asks for battle info a few times, then shoots: its next action depends on how many turns it played
+class PatientTank : public TankAlgorithm {
+public:
+    explicit PatientTank(int wait) : wait_(wait) {}
+    ActionRequest getAction() override { return wait_-- > 0 ? ActionRequest::GetBattleInfo : ActionRequest::Shoot; }
+    void updateBattleInfo(BattleInfo&) override {}
+private:
+    int wait_;
+};
+
+// Player 1's tank drives around its row, player 2's spins: the state repeats every 12 turns
+const size_t kWidth = 6, kHeight = 3;
+const vector<char> kLoopMap = mapOf({
+    "######",
+    " 1    ",
+    "####2#",
+});
+
+TankAlgorithmFactory loopingTanks() {
+    return [](int player, int) {
+        return std::make_unique<SameActionTank>(player == 1 ? ActionRequest::MoveForward : ActionRequest::RotateLeft90);
+    };
+}
+
+GameManagerOptions cycleDetection(const bool on) {
+    GameManagerOptions options;
+    options.cycleDetection = on;
+    return options;
+}
+} // namespace
+
+// ------- stateless algorithms: cycles are skipped, the game ends the same -------
+TEST(CycleDetection, SkippedGameEndsLikeTheFullGame) {
+    const PlayedGame full = play(kWidth, kHeight, kLoopMap, cycleDetection(false), loopingTanks(), 3000);
+    const PlayedGame skipped = play(kWidth, kHeight, kLoopMap, cycleDetection(true), loopingTanks(), 3000);
+
+    EXPECT_EQ(full.hashes.size(), 3000u);
+    EXPECT_LT(skipped.hashes.size(), 40u); // step(1) calls: three periods (see, confirm, skip) instead of 3000 turns
+    ASSERT_FALSE(skipped.hashes.empty());
+    EXPECT_EQ(skipped.hashes.back(), full.hashes.back()); // State at the step limit
+    expectSameResult(skipped.result, full.result);
+}
+
+// ------- with verbose logging every turn is played and logged -------
+TEST(CycleDetection, VerboseGamePlaysEveryTurn) {
+    GM_209277367_322542887 gm(true);
+    gm.setOptions(cycleDetection(true));
+    const PlayedGame verbose = playOn(gm, kWidth, kHeight, kLoopMap, loopingTanks(), 300);
+    const PlayedGame full = play(kWidth, kHeight, kLoopMap, cycleDetection(false), loopingTanks(), 300);
+
+    expectSameGame(verbose, full);
+    const string logName = "output_map_GM_209277367_322542887_p1_p2";
+    std::ifstream log(logName);
+    size_t lines = 0;
+    for (string line; std::getline(log, line);) { ++lines; }
+    EXPECT_EQ(lines, 301u); // One line per round, none skipped, and the result
+    log.close();
+    std::remove(logName.c_str());
+}
+
+// ------- algorithms with state play every turn -------
+TEST(CycleDetection, StatefulAlgorithmsAreNotSkipped) {
+    // Both tanks ask for battle info (the state repeats at once), then player 2's tank shoots player 1's
+    const vector<char> cells = mapOf({
+        "#######",
+        "#1   2#",
+        "#######",
+    });
+    auto factory = [](int player, int) { return std::make_unique<PatientTank>(player == 2 ? 8 : 1 << 20); };
+
+    const PlayedGame full = play(7, 3, cells, cycleDetection(false), factory, 3000);
+    const PlayedGame detected = play(7, 3, cells, cycleDetection(true), factory, 3000);
+
+    EXPECT_EQ(full.result.winner, 2);
+    EXPECT_EQ(full.result.reason, GameResult::ALL_TANKS_DEAD);
+    EXPECT_EQ(detected.hashes, full.hashes);
+    expectSameResult(detected.result, full.result);
+}
+
+// ------- a restore forgets the states of the abandoned timeline -------
+TEST(CycleDetection, RestoreThenStepEndsLikeTheFullGame) {
+    const PlayedGame full = play(kWidth, kHeight, kLoopMap, cycleDetection(false), loopingTanks(), 500);
+
+    ExtSatelliteView map(kWidth, kHeight, kLoopMap);
+    SilentPlayer player1, player2;
+    GM_209277367_322542887 gm(false);
+    gm.setOptions(cycleDetection(true));
+    ASSERT_TRUE(gm.init(kWidth, kHeight, map, "map", 500, 30, player1, "p1", player2, "p2", loopingTanks(), loopingTanks()));
+
+    GameSnapshot snapshot;
+    ASSERT_TRUE(gm.step(2));
+    gm.snapshot(snapshot);
+    ASSERT_TRUE(gm.step(8)); // Records the states of turns 3 to 10
+    gm.restore(snapshot); // Back to turn 2, where those states come round again
+
+    uint64_t last = 0;
+    while (gm.step(1)) { last = gm.getStateHash(); }
+    EXPECT_EQ(gm.getTurn(), 500);
+    EXPECT_EQ(last, full.hashes.back());
+    expectSameResult(gm.result(), full.result);
+}
+
+// ------- boards of more than 2^20 cells -------
+TEST(CycleDetection, KeysOfLargeValuesDoNotCollide) {
+    // Tank 0 at cell X and tank 1 at cell X ^ 2^20 must not hash like the two tanks swapped
+    for (const uint64_t cell : {uint64_t{5}, uint64_t{1} << 20, uint64_t{1099999}}) {
+        const uint64_t other = cell ^ (uint64_t{1} << 20);
+        EXPECT_NE(zobristKey(ZobristFeature::TankCell, 0, cell), zobristKey(ZobristFeature::TankCell, 1, other));
+        EXPECT_NE(zobristKey(ZobristFeature::TankCell, 0, cell) ^ zobristKey(ZobristFeature::TankCell, 1, other),
+                  zobristKey(ZobristFeature::TankCell, 0, other) ^ zobristKey(ZobristFeature::TankCell, 1, cell));
+        EXPECT_NE(zobristKey(ZobristFeature::TankAmmo, 0, cell), zobristKey(ZobristFeature::TankAmmo, 1, other));
+    }
+}
+
+TEST(CycleDetection, LargeBoardSkipsLikeTheFullGame) {
+    // 1100x1000 walls: player 1's tank drives along the open last row (cells past 2^20) and wraps
+    // around every 1100 turns, player 2's tank spins in a pocket of the row above
+    const size_t width = 1100, height = 1000;
+    vector<char> cells(width * height, '#');
+    std::fill(cells.end() - static_cast<std::ptrdiff_t>(width), cells.end(), ' ');
+    cells[(height - 1) * width + 3] = '1';
+    cells[(height - 2) * width + 3] = '2';
+    ASSERT_GT((height - 2) * width, size_t{1} << 20);
+
+    const PlayedGame full = play(width, height, cells, cycleDetection(false), loopingTanks(), 5000);
+    const PlayedGame skipped = play(width, height, cells, cycleDetection(true), loopingTanks(), 5000);
+
+    EXPECT_EQ(full.hashes.size(), 5000u);
+    EXPECT_LT(skipped.hashes.size(), 4000u); // A period to see the repeat, one to confirm it, then the rest is skipped
+    ASSERT_FALSE(skipped.hashes.empty());
+    EXPECT_EQ(skipped.hashes.back(), full.hashes.back());
+    expectSameResult(skipped.result, full.result);
+}
@@ -0,0 +1,71 @@
+#include "./utils/gm_utils.test.cpp"
+#include "GameArena.h"
+#include <thread>
+
+// Each test runs on a fresh thread, so it starts with a fresh arena
+
+// ------- the arena resets only once nothing allocated from it is alive -------
+TEST(GameArena, LiveAllocationsBlockTheReset) {
+    std::thread([] {
+        const shared_ptr<GameArena> arena = GameArena::forThisThread();
+        GameArena::Lease lease;
+        ArenaVector<int> cells(lease.resource());
+        cells.resize(100000);
+        EXPECT_GE(arena->getLiveBytes(), cells.size() * sizeof(int));
+
+        const size_t resets = arena->getResets();
+        lease.renew();
+        EXPECT_EQ(arena->getResets(), resets); // cells still lives in the arena
+
+        freeArenaMemory(cells);
+        EXPECT_EQ(arena->getLiveBytes(), 0u);
+        lease.renew();
+        EXPECT_EQ(arena->getResets(), resets + 1);
+        EXPECT_GE(arena->getRetainedBytes(), 100000 * sizeof(int)); // Kept for the next game
+    }).join();
+}
+
+// ------- a reused GameManager resets the arena every game, and its memory stays bounded -------
+TEST(GameArena, ReusedGameManagerKeepsItsMemoryBounded) {
+    std::thread([] {
+        const shared_ptr<GameArena> arena = GameArena::forThisThread();
+        // 1000x1000 gets a neighbor table and 1100x1000 does not, so every other game builds it anew
+        const vector<char> wide = randomMap(1100, 1000, 15, 2, 1), square = randomMap(1000, 1000, 15, 2, 2);
+        GM_209277367_322542887 gm(false);
+
+        size_t peak = 0; // Most the arena held after one game of each size
+        for (size_t round = 0; round < 8; ++round) {
+            const size_t resets = arena->getResets();
+            if (round % 2 == 0) {
+                playOn(gm, 1100, 1000, wide, randomTanks(1, 2), 5);
+            } else {
+                playOn(gm, 1000, 1000, square, randomTanks(1, 2), 5);
+            }
+            EXPECT_EQ(arena->getResets(), resets + 1) << "round " << round;
+            if (round < 2) {
+                peak = std::max(peak, arena->getHeldBytes());
+            } else {
+                // Without the reset, each game's neighbor table stays in the monotonic buffer
+                EXPECT_LE(arena->getHeldBytes(), peak + peak / 4) << "round " << round;
+            }
+        }
+    }).join();
+}
+
+// ------- the arena and its buffer go with the thread's last game manager -------
+TEST(GameArena, ArenaIsFreedWithTheLastGameManager) {
+    std::thread([] {
+        std::weak_ptr<GameArena> played;
+        {
+            GM_209277367_322542887 gm(false);
+            playOn(gm, 30, 20, randomMap(30, 20, 10, 5, 3), randomTanks(1, 2), 20);
+            played = GameArena::forThisThread();
+            EXPECT_GT(played.lock()->getResets(), 0u);
+        }
+        EXPECT_TRUE(played.expired()); // Nothing kept for the rest of the thread's life
+
+        const shared_ptr<GameArena> arena = GameArena::forThisThread();
+        EXPECT_EQ(arena->getResets(), 0u);
+        EXPECT_EQ(arena->getRetainedBytes(), 0u);
+    }).join();
+}
@@ -0,0 +1,103 @@
+#include "./utils/gm_utils.test.cpp"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace {
+const string kLogName = "output_map_GM_209277367_322542887_p1_p2"; // Verbose log of a game on "map" between "p1" and "p2"
+
+// Plays its script, then does nothing
+class ScriptedTank : public TankAlgorithm {
+public:
+    explicit ScriptedTank(vector<ActionRequest> script) : script_(std::move(script)) {}
+    ActionRequest getAction() override { return next_ < script_.size() ? script_[next_++] : ActionRequest::DoNothing; }
+    void updateBattleInfo(BattleInfo&) override {}
+private:
+    vector<ActionRequest> script_;
+    size_t next_ = 0;
+};
+
+// Whole contents of the verbose log, which is then deleted
+string readLog() {
+    std::ifstream file(kLogName);
+    std::stringstream text;
+    text << file.rdbuf();
+    file.close();
+    std::remove(kLogName.c_str());
+    return text.str();
+}
+} // namespace
+
+// ------- quiet and verbose games play the same; only the verbose one writes a log -------
+TEST(GameLog, QuietAndVerboseGamesPlayTheSame) {
+    std::remove(kLogName.c_str());
+    std::mt19937 rng(43);
+    for (int game = 0; game < 6; ++game) {
+        const size_t width = 6 + rng() % 30, height = 6 + rng() % 30;
+        const vector<char> cells = randomMap(width, height, 10, 3, rng());
+        const TankAlgorithmFactory tanks = randomTanks(rng(), 3);
+        SCOPED_TRACE(testing::Message() << "game " << game << " (" << width << "x" << height << ")");
+
+        GM_209277367_322542887 quiet(false), verbose(true);
+        const PlayedGame quietGame = playOn(quiet, width, height, cells, tanks);
+        EXPECT_FALSE(std::ifstream(kLogName).is_open());
+        expectSameGame(playOn(verbose, width, height, cells, tanks), quietGame);
+        EXPECT_FALSE(readLog().empty());
+    }
+}
+
+// ------- the log reads exactly as the unbuffered log did -------
+TEST(GameLog, ScriptedGameWritesTheExpectedLog) {
+    using enum ActionRequest;
+    // Tank 1 (player 1) shoots tank 0 (player 1), then drives onto its cell, where tank 2 (player 2) shoots it
+    const vector<char> cells = mapOf({
+        "#########",
+        "#1 1   2#",
+        "#########",
+    });
+    auto factory = [](int player, int tank) {
+        if (player == 2) return std::make_unique<ScriptedTank>(vector{DoNothing, RotateLeft90, RotateLeft90, DoNothing, DoNothing, Shoot});
+        if (tank == 1) return std::make_unique<ScriptedTank>(vector{Shoot, Shoot, DoNothing, MoveForward, MoveForward});
+        return std::make_unique<ScriptedTank>(vector<ActionRequest>{});
+    };
+    ExtSatelliteView map(9, 3, cells);
+    SilentPlayer player1, player2;
+    GM_209277367_322542887 gm(true);
+    gm.run(9, 3, map, "map", 40, 30, player1, "p1", player2, "p2", factory, factory);
+
+    EXPECT_EQ(readLog(),
+        "DoNothing (killed), Shoot, DoNothing\n"
+        "killed, Shoot (ignored), RotateLeft90\n"
+        "killed, DoNothing, RotateLeft90\n"
+        "killed, MoveForward, DoNothing\n"
+        "killed, MoveForward, DoNothing\n"
+        "killed, DoNothing, Shoot\n"
+        "killed, DoNothing, DoNothing\n"
+        "killed, DoNothing (killed), DoNothing\n"
+        "Player 2 won with 1 tanks still alive\n");
+}
+
+// ------- a long game: one line per round, all of it reaches the file -------
+TEST(GameLog, LongGameLogsEveryRound) {
+    const vector<char> cells = randomMap(30, 20, 10, 2, 9);
+    const auto tanks = std::count(cells.begin(), cells.end(), '1') + std::count(cells.begin(), cells.end(), '2');
+    auto spinning = [](int, int) { return std::make_unique<ScriptedTank>(vector<ActionRequest>(3000, ActionRequest::RotateRight45)); };
+    GM_209277367_322542887 gm(true);
+    const PlayedGame played = playOn(gm, 30, 20, cells, spinning, 3000);
+    const string log = readLog();
+    const size_t rounds = played.hashes.size();
+    ASSERT_EQ(rounds, 3000u);
+    ASSERT_GT(log.size(), size_t{1} << 18); // Many chunks of the log buffer
+
+    vector<string> lines;
+    std::istringstream text(log);
+    for (string line; std::getline(text, line);) { lines.push_back(line); }
+    ASSERT_EQ(lines.size(), rounds + 1);
+    for (size_t round = 0; round < rounds; ++round) {
+        ASSERT_EQ(std::count(lines[round].begin(), lines[round].end(), ','), tanks - 1) << "round " << round;
+        ASSERT_EQ(lines[round].substr(0, 14), "RotateRight45,") << "round " << round;
+    }
+    EXPECT_EQ(lines.back().rfind("Tie, reached max steps = 3000, ", 0), 0u);
+    EXPECT_EQ(log.back(), '\n');
+}
@@ -0,0 +1,100 @@
+#include "./utils/gm_utils.test.cpp"
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+namespace {
+// A random tank that asks for battle info every fifth turn
+class ChattyTank : public RandomTank {
+public:
+    ChattyTank(uint32_t seed, unsigned shots) : RandomTank(seed, shots) {}
+    ActionRequest getAction() override {
+        const ActionRequest action = RandomTank::getAction();
+        return ++turns_ % 5 == 0 ? ActionRequest::GetBattleInfo : action;
+    }
+private:
+    unsigned turns_ = 0;
+};
+
+// Counts the battle-info requests it is handed
+class CountingPlayer : public Player {
+public:
+    void updateTankWithBattleInfo(TankAlgorithm&, SatelliteView&) override { ++requests; }
+    size_t requests = 0;
+};
+
+const int kMaxSteps = 200;
+
+// The figures GameStats should hold, counted from outside the engine
+struct Expected {
+    size_t turns = 0, tankTurns = 0, shellTurns = 0, maxShells = 0;
+};
+} // namespace
+
+// ------- the counters match what the game did, turn by turn -------
+TEST(GameStats, CountersMatchTheGame) {
+    const fs::path folder = fs::temp_directory_path() / "gm_stats_test";
+    fs::create_directories(folder);
+
+    std::mt19937 rng(53);
+    for (int game = 0; game < 6; ++game) {
+        const size_t width = 8 + rng() % 30, height = 8 + rng() % 30;
+        const vector<char> cells = randomMap(width, height, 10, 3, rng());
+        const uint32_t seed = rng();
+        SCOPED_TRACE(testing::Message() << "game " << game << " (" << width << "x" << height << ")");
+
+        GameManagerOptions options;
+        options.statsFolder = folder.string();
+        GM_209277367_322542887 gm(false);
+        gm.setOptions(options);
+        ExtSatelliteView map(width, height, cells);
+        CountingPlayer player1, player2;
+        auto factory = [seed](int player, int tank) {
+            return std::make_unique<ChattyTank>(seed + static_cast<uint32_t>(player * 7919 + tank), 4);
+        };
+        if (!gm.init(width, height, map, "map", kMaxSteps, 20, player1, "p1", player2, "p2", factory, factory)) { continue; }
+
+        Expected expected;
+        GameSnapshot state;
+        for (bool running = true; running;) {
+            gm.snapshot(state);
+            const int turn = gm.getTurn();
+            running = gm.step(1);
+            if (turn >= kMaxSteps) { break; } // Ended at the step limit without playing a turn
+
+            ++expected.turns;
+            expected.tankTurns += state.tanks.alive[1] + state.tanks.alive[2];
+            gm.snapshot(state);
+            expected.shellTurns += state.shells.aliveCount;
+            expected.maxShells = std::max(expected.maxShells, state.shells.aliveCount);
+        }
+
+        const GameStats& stats = gm.getStats();
+        EXPECT_GT(stats.turns, 0u);
+        EXPECT_EQ(stats.turns, expected.turns);
+        EXPECT_EQ(stats.tankTurns, expected.tankTurns);
+        EXPECT_EQ(stats.shellTurns, expected.shellTurns);
+        EXPECT_EQ(stats.maxShells, expected.maxShells);
+        EXPECT_EQ(stats.battleInfoRequests, player1.requests + player2.requests);
+        EXPECT_GT(stats.battleInfoRequests, 0u);
+
+        std::ifstream file(folder / "stats_map_GM_209277367_322542887_p1_p2.txt");
+        string key;
+        size_t turns = 0;
+        file >> key >> turns;
+        EXPECT_EQ(key, "turns");
+        EXPECT_EQ(turns, expected.turns);
+    }
+    fs::remove_all(folder);
+}
+
+// ------- without a stats folder nothing is collected -------
+TEST(GameStats, NothingIsCollectedWithoutAFolder) {
+    GM_209277367_322542887 gm(false);
+    const PlayedGame played = playOn(gm, 20, 12, randomMap(20, 12, 10, 3, 5), randomTanks(5, 4));
+    EXPECT_FALSE(played.hashes.empty());
+    EXPECT_EQ(gm.getStats().turns, 0u);
+    EXPECT_EQ(gm.getStats().tankTurns, 0u);
+}
@@ -0,0 +1,138 @@
+#include "InstancePool.h"
+#include "ExtGameManager.h"
+#include "Resettable.h"
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+using namespace UserCommon_209277367_322542887;
+
+namespace {
+struct PlainPlayer : Player {
+    void updateTankWithBattleInfo(TankAlgorithm&, SatelliteView&) override {}
+};
+
+struct ReusablePlayer : PlainPlayer, ResettablePlayer {
+    int index = -1;
+    size_t width = 0;
+    int resets = 0;
+    void reset(int player_index, size_t x, size_t, size_t, size_t) override { index = player_index, width = x, ++resets; }
+};
+
+struct ReusableTank : TankAlgorithm, ResettableTankAlgorithm {
+    int player = 0, tank = 0;
+    ReusableTank(int player_index, int tank_index) : player(player_index), tank(tank_index) {}
+    ActionRequest getAction() override { return ActionRequest::DoNothing; }
+    void updateBattleInfo(BattleInfo&) override {}
+    void reset(int player_index, int tank_index) override { player = player_index, tank = tank_index; }
+};
+
+// Holds tank algorithms the way a GameManager would, and hands them back when asked
+struct HoldingGameManager : ExtGameManager {
+    std::vector<unique_ptr<TankAlgorithm>> tanks[2];
+    GameResult run(size_t, size_t, const SatelliteView&, string, size_t, size_t, Player&, string, Player&, string,
+                   TankAlgorithmFactory, TankAlgorithmFactory) override { return {}; }
+    void setOptions(const GameManagerOptions&) override {}
+    BudgetReport getBudgetReport() const override { return {}; }
+    bool init(size_t, size_t, const SatelliteView&, string, size_t, size_t, Player&, string, Player&, string,
+              TankAlgorithmFactory, TankAlgorithmFactory) override { return false; }
+    bool step(size_t) override { return false; }
+    bool finished() const override { return true; }
+    GameResult result() override { return {}; }
+    std::vector<unique_ptr<TankAlgorithm>> releaseTankAlgorithms(int player) override { return std::move(tanks[player - 1]); }
+};
+
+AlgorithmRegistrar::AlgorithmAndPlayerFactories makeAlgorithm(const string& name, bool reusable, int& created) {
+    AlgorithmRegistrar::AlgorithmAndPlayerFactories algo(name);
+    algo.setPlayerFactory([reusable, &created](int, size_t, size_t, size_t, size_t) -> unique_ptr<Player> {
+        ++created;
+        if (reusable) { return std::make_unique<ReusablePlayer>(); }
+        return std::make_unique<PlainPlayer>();
+    });
+    algo.setTankAlgorithmFactory([&created](int player_index, int tank_index) -> unique_ptr<TankAlgorithm> {
+        ++created;
+        return std::make_unique<ReusableTank>(player_index, tank_index);
+    });
+    return algo;
+}
+} // namespace
+
+// ------- players -------
+TEST(InstancePool, ResettablePlayersAreResetAndReused) {
+    int created = 0;
+    const auto algo = makeAlgorithm("A", true, created);
+    InstancePool pool;
+
+    auto player = pool.takePlayer(algo, 1, 10, 8, 100, 5);
+    Player* first = player.get();
+    pool.returnPlayer("A", std::move(player));
+
+    auto again = pool.takePlayer(algo, 2, 30, 20, 100, 5);
+    EXPECT_EQ(again.get(), first);
+    EXPECT_EQ(created, 1);
+    const auto& reused = dynamic_cast<const ReusablePlayer&>(*again);
+    EXPECT_EQ(reused.index, 2);
+    EXPECT_EQ(reused.width, 30u);
+    EXPECT_EQ(reused.resets, 1);
+}
+
+TEST(InstancePool, OtherPlayersAreCreatedPerGame) {
+    int created = 0;
+    const auto algo = makeAlgorithm("B", false, created);
+    InstancePool pool;
+
+    pool.returnPlayer("B", pool.takePlayer(algo, 1, 10, 8, 100, 5));
+    auto player = pool.takePlayer(algo, 1, 10, 8, 100, 5);
+    EXPECT_NE(player, nullptr);
+    EXPECT_EQ(created, 2);
+}
+
+TEST(InstancePool, PlayersAreKeptPerAlgorithm) {
+    int created = 0;
+    const auto a = makeAlgorithm("A", true, created), b = makeAlgorithm("B", true, created);
+    InstancePool pool;
+
+    pool.returnPlayer("A", pool.takePlayer(a, 1, 10, 8, 100, 5));
+    auto player = pool.takePlayer(b, 1, 10, 8, 100, 5); // A's player is not B's
+    EXPECT_EQ(created, 2);
+}
+
+// ------- tank algorithms -------
+TEST(InstancePool, TankAlgorithmsComeBackFromTheGameManager) {
+    int created = 0;
+    const auto a = makeAlgorithm("A", true, created), b = makeAlgorithm("B", true, created);
+    InstancePool pool;
+
+    HoldingGameManager gm;
+    auto factoryA = pool.tankAlgorithmFactory(a), factoryB = pool.tankAlgorithmFactory(b);
+    gm.tanks[0].push_back(factoryA(1, 0));
+    gm.tanks[0].push_back(factoryA(1, 1));
+    gm.tanks[1].push_back(factoryB(2, 0));
+    EXPECT_EQ(created, 3);
+
+    pool.returnTankAlgorithms(gm, "A", "B");
+    auto tank = pool.tankAlgorithmFactory(a)(2, 7); // Player 1's tanks, now for player 2
+    auto other = pool.tankAlgorithmFactory(b)(1, 3);
+    EXPECT_EQ(created, 3);
+    EXPECT_EQ(dynamic_cast<ReusableTank&>(*tank).player, 2);
+    EXPECT_EQ(dynamic_cast<ReusableTank&>(*tank).tank, 7);
+    EXPECT_EQ(dynamic_cast<ReusableTank&>(*other).tank, 3);
+
+    pool.tankAlgorithmFactory(a)(1, 0); // One kept instance left for A
+    EXPECT_EQ(created, 3);
+    pool.tankAlgorithmFactory(a)(1, 1);
+    EXPECT_EQ(created, 4);
+}
+
+// ------- game managers -------
+TEST(InstancePool, ExtGameManagersPlayAgain) {
+    InstancePool pool;
+    int created = 0;
+    auto create = [&created]() -> unique_ptr<AbstractGameManager> { ++created; return std::make_unique<HoldingGameManager>(); };
+
+    auto gm = pool.takeGameManager(create);
+    AbstractGameManager* first = gm.get();
+    pool.returnGameManager(std::move(gm));
+    EXPECT_EQ(pool.takeGameManager(create).get(), first);
+    EXPECT_EQ(created, 1);
+}
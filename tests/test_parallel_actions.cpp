@@ -0,0 +1,85 @@
+#include "./utils/gm_utils.test.cpp"
+#include "ThreadSafeTankAlgorithm.h"
+#include <thread>
+
+namespace {
+// A random tank that declares itself safe to call from a worker thread
+class SafeRandomTank : public RandomTank, public ThreadSafeTankAlgorithm {
+public:
+    using RandomTank::RandomTank;
+};
+
+TankAlgorithmFactory safeRandomTanks(const uint32_t seed, const unsigned shots) {
+    return [seed, shots](int player, int tank) {
+        return std::make_unique<SafeRandomTank>(seed + static_cast<uint32_t>(player * 7919 + tank), shots);
+    };
+}
+
+// A random tank that remembers whether it was ever called off the given thread
+class ThreadCheckingTank : public RandomTank {
+public:
+    ThreadCheckingTank(uint32_t seed, unsigned shots, std::thread::id game_thread, bool& off_thread)
+        : RandomTank(seed, shots), gameThread_(game_thread), offThread_(off_thread) {}
+    ActionRequest getAction() override {
+        if (std::this_thread::get_id() != gameThread_) { offThread_ = true; }
+        return RandomTank::getAction();
+    }
+private:
+    std::thread::id gameThread_;
+    bool& offThread_;
+};
+
+GameManagerOptions parallel(const size_t action_budget_ms = 0) {
+    GameManagerOptions options;
+    options.parallelActions = true;
+    options.actionBudgetMs = action_budget_ms;
+    return options;
+}
+} // namespace
+
+// ------- thread-safe tanks: collecting actions on the pool plays the same game as the sequential loop -------
+TEST(ParallelActions, ThreadSafeTanksPlayAsSequential) {
+    std::mt19937 rng(59);
+    for (int game = 0; game < 12; ++game) {
+        const size_t width = 10 + rng() % 40, height = 10 + rng() % 40;
+        const vector<char> cells = randomMap(width, height, rng() % 15, 2 + rng() % 6, rng());
+        const TankAlgorithmFactory tanks = safeRandomTanks(rng(), 1 + rng() % 8);
+        SCOPED_TRACE(testing::Message() << "game " << game << " (" << width << "x" << height << ")");
+        const PlayedGame sequential = play(width, height, cells, GameManagerOptions{}, tanks);
+        EXPECT_FALSE(sequential.hashes.empty());
+        expectSameGame(play(width, height, cells, parallel(), tanks), sequential);
+    }
+}
+
+// ------- with an action budget the parallel path charges every tank as the sequential loop does -------
+TEST(ParallelActions, ThreadSafeTanksWithBudgetsPlayAsSequential) {
+    std::mt19937 rng(61);
+    for (int game = 0; game < 6; ++game) {
+        const size_t width = 10 + rng() % 30, height = 10 + rng() % 30;
+        const vector<char> cells = randomMap(width, height, 10, 4, rng());
+        const TankAlgorithmFactory tanks = safeRandomTanks(rng(), 4);
+        SCOPED_TRACE(testing::Message() << "game " << game << " (" << width << "x" << height << ")");
+        GameManagerOptions budgeted;
+        budgeted.actionBudgetMs = 10000; // Generous: no call runs out, so only the charging path differs
+        expectSameGame(play(width, height, cells, parallel(10000), tanks), play(width, height, cells, budgeted, tanks));
+    }
+}
+
+// ------- tanks that are not thread safe keep the sequential loop, on the game thread -------
+TEST(ParallelActions, PlainTanksStayOnTheGameThread) {
+    std::mt19937 rng(67);
+    for (int game = 0; game < 4; ++game) {
+        const size_t width = 10 + rng() % 30, height = 10 + rng() % 30;
+        const vector<char> cells = randomMap(width, height, 10, 4, rng());
+        const uint32_t seed = rng();
+        SCOPED_TRACE(testing::Message() << "game " << game << " (" << width << "x" << height << ")");
+        bool off_thread = false;
+        const std::thread::id game_thread = std::this_thread::get_id();
+        auto checking = [seed, game_thread, &off_thread](int player, int tank) {
+            return std::make_unique<ThreadCheckingTank>(seed + static_cast<uint32_t>(player * 7919 + tank), 4, game_thread, off_thread);
+        };
+        const PlayedGame parallel_game = play(width, height, cells, parallel(), checking);
+        EXPECT_FALSE(off_thread);
+        expectSameGame(parallel_game, play(width, height, cells, GameManagerOptions{}, randomTanks(seed, 4)));
+    }
+}
@@ -0,0 +1,162 @@
+#include "./utils/gm_utils.test.cpp"
+#include "Replay.h"
+#include <filesystem>
+#include <unistd.h>
+
+namespace fs = std::filesystem;
+
+namespace {
+// Fresh folder under the temp directory, removed with the test
+class ReplayFolder {
+public:
+    ReplayFolder() : path_(fs::temp_directory_path() / ("replay_test_" + std::to_string(::getpid()))) {
+        fs::remove_all(path_);
+        fs::create_directories(path_);
+    }
+    ~ReplayFolder() { fs::remove_all(path_); }
+    const fs::path& path() const { return path_; }
+private:
+    fs::path path_;
+};
+
+ReplayKeyframe keyframeAt(const size_t turn, const int far_cell) {
+    ReplayKeyframe keyframe;
+    keyframe.turn = turn;
+    keyframe.board = vector<char>(300, ' ');
+    keyframe.board[0] = '#', keyframe.board[299] = '@';
+    keyframe.tanks = {
+        {0, 1, 17, Direction::L, 16, 0, 0, false, false, 0},
+        {0, 2, far_cell, Direction::UR, 200, 3, 2, true, false, 0},
+        {1, 2, -1, Direction::D, 0, 4, 0, false, true, 9},
+    };
+    keyframe.shells = {{250, Direction::DL, true}, {12, Direction::R, false}};
+    keyframe.noAmmoFlag = true, keyframe.noAmmoTimer = 40;
+    keyframe.numTanks1 = 1, keyframe.numTanks2 = 1;
+    return keyframe;
+}
+
+void expectSameKeyframe(const ReplayKeyframe& actual, const ReplayKeyframe& expected) {
+    EXPECT_EQ(actual.turn, expected.turn);
+    EXPECT_EQ(actual.board, expected.board);
+    ASSERT_EQ(actual.tanks.size(), expected.tanks.size());
+    for (size_t i = 0; i < expected.tanks.size(); ++i) {
+        const TankState &a = actual.tanks[i], &e = expected.tanks[i];
+        EXPECT_EQ(std::tie(a.id, a.playerId, a.cell, a.dir, a.ammo, a.turnsToShoot, a.turnsToBackwards, a.backwardsFlag,
+                           a.justMovedBackwards, a.turnsDead),
+                  std::tie(e.id, e.playerId, e.cell, e.dir, e.ammo, e.turnsToShoot, e.turnsToBackwards, e.backwardsFlag,
+                           e.justMovedBackwards, e.turnsDead)) << "tank " << i;
+    }
+    ASSERT_EQ(actual.shells.size(), expected.shells.size());
+    for (size_t i = 0; i < expected.shells.size(); ++i) {
+        EXPECT_EQ(actual.shells[i].cell, expected.shells[i].cell);
+        EXPECT_EQ(actual.shells[i].dir, expected.shells[i].dir);
+        EXPECT_EQ(actual.shells[i].aboveMine, expected.shells[i].aboveMine);
+    }
+    EXPECT_EQ(actual.noAmmoFlag, expected.noAmmoFlag);
+    EXPECT_EQ(actual.noAmmoTimer, expected.noAmmoTimer);
+    EXPECT_EQ(actual.numTanks1, expected.numTanks1);
+    EXPECT_EQ(actual.numTanks2, expected.numTanks2);
+}
+} // namespace
+
+// ------- what the writer encodes, the reader decodes -------
+TEST(Replay, EncodeDecodeRoundTrip) {
+    const ReplayFolder folder;
+    const string file = (folder.path() / "round_trip.replay").string();
+
+    ReplayHeader header;
+    header.width = 20, header.height = 15, header.maxSteps = 100000, header.numShells = 16;
+    header.keyframeInterval = 4, header.numTanks = 3, header.mapFingerprint = 0x0123456789abcdefULL;
+
+    // Ten turns with repeated, changed and ignored actions, and a keyframe every four turns
+    vector<vector<pair<ActionRequest, bool>>> turns;
+    for (size_t turn = 0; turn < 10; ++turn) {
+        turns.push_back({
+            {ActionRequest::MoveForward, true},
+            {static_cast<ActionRequest>(turn % 8), turn % 3 != 0},
+            {ActionRequest::DoNothing, false},
+        });
+    }
+    const vector<ReplayKeyframe> keyframes = {keyframeAt(0, 5), keyframeAt(4, 299), keyframeAt(8, 150)};
+    {
+        ReplayWriter writer;
+        ASSERT_TRUE(writer.open(file, header));
+        for (size_t turn = 0; turn < turns.size(); ++turn) {
+            if (turn % header.keyframeInterval == 0) writer.writeKeyframe(keyframes[turn / header.keyframeInterval]);
+            writer.writeTurn(turns[turn]);
+        }
+    } // The destructor finishes the file
+
+    ReplayReader reader;
+    string error;
+    ASSERT_TRUE(reader.load(file, error)) << error;
+    const ReplayHeader& read = reader.getHeader();
+    EXPECT_EQ(std::tie(read.width, read.height, read.maxSteps, read.numShells, read.keyframeInterval, read.numTanks, read.mapFingerprint),
+              std::tie(header.width, header.height, header.maxSteps, header.numShells, header.keyframeInterval, header.numTanks,
+                       header.mapFingerprint));
+
+    ASSERT_EQ(reader.getTurnCount(), turns.size());
+    vector<pair<ActionRequest, bool>> actions;
+    for (size_t turn = 0; turn < turns.size(); ++turn) {
+        reader.getActions(turn, actions);
+        EXPECT_EQ(actions, turns[turn]) << "turn " << turn;
+        expectSameKeyframe(reader.getKeyframeFor(turn), keyframes[turn / header.keyframeInterval]);
+    }
+}
+
+TEST(Replay, TruncatedFileIsRejected) {
+    const ReplayFolder folder;
+    const string file = (folder.path() / "truncated.replay").string();
+    {
+        ReplayWriter writer;
+        ReplayHeader header;
+        header.width = 20, header.height = 15, header.keyframeInterval = 4, header.numTanks = 3;
+        ASSERT_TRUE(writer.open(file, header));
+        writer.writeKeyframe(keyframeAt(0, 5));
+        writer.writeTurn(vector<pair<ActionRequest, bool>>(3, {ActionRequest::Shoot, true}));
+    }
+    fs::resize_file(file, fs::file_size(file) - 1); // Drop the end marker
+
+    ReplayReader reader;
+    string error;
+    EXPECT_FALSE(reader.load(file, error));
+    EXPECT_FALSE(error.empty());
+}
+
+// ------- seeking to a turn rebuilds the state of a straight play -------
+TEST(Replay, SeekMatchesStraightPlay) {
+    const ReplayFolder folder;
+    const size_t width = 40, height = 30;
+    const vector<char> cells = randomMap(width, height, 12, 2, 5);
+
+    GameManagerOptions options;
+    options.replayFolder = folder.path().string();
+    options.replayKeyframeInterval = 8;
+
+    // Straight play: the state hash at the start of every turn
+    vector<uint64_t> hashes;
+    {
+        ExtSatelliteView map(width, height, cells);
+        SilentPlayer player1, player2;
+        GM_209277367_322542887 gm(false);
+        gm.setOptions(options);
+        ASSERT_TRUE(gm.init(width, height, map, "seek", 60, 30, player1, "p1", player2, "p2", randomTanks(9, 3), randomTanks(9, 3)));
+        hashes.push_back(gm.getStateHash());
+        while (gm.step(1)) { hashes.push_back(gm.getStateHash()); }
+    }
+
+    ReplayReader replay;
+    string error;
+    ASSERT_TRUE(replay.load((folder.path() / "replay_seek_GM_209277367_322542887_p1_p2.replay").string(), error)) << error;
+    ASSERT_EQ(replay.getTurnCount() + 1, hashes.size());
+
+    // Turns on, next to and between keyframes, in any order, on one instance
+    GM_209277367_322542887 gm(false);
+    for (const size_t turn : {size_t{0}, size_t{13}, size_t{8}, size_t{1}, size_t{16}, size_t{59}, replay.getTurnCount()}) {
+        if (turn >= hashes.size()) continue;
+        ASSERT_TRUE(gm.replayTo(replay, turn)) << "turn " << turn;
+        EXPECT_EQ(gm.getTurn(), static_cast<int>(turn));
+        EXPECT_EQ(gm.getStateHash(), hashes[turn]) << "turn " << turn;
+    }
+    EXPECT_FALSE(gm.replayTo(replay, replay.getTurnCount() + 1));
+}
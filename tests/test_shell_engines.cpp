@@ -0,0 +1,76 @@
+#include "./utils/gm_utils.test.cpp"
+#include <chrono>
+#include <iostream>
+
+namespace {
+GameManagerOptions engine(const ShellEngine shell_engine) {
+    GameManagerOptions options;
+    options.shellEngine = shell_engine;
+    return options;
+}
+
+// Milliseconds to play one whole game with the given engine, best of five runs
+double timedGame(const size_t width, const size_t height, const vector<char>& cells, const ShellEngine shell_engine,
+                 const TankAlgorithmFactory& factory, const size_t max_steps) {
+    double best = 0;
+    for (int run = 0; run < 5; ++run) {
+        const auto start = std::chrono::steady_clock::now();
+        play(width, height, cells, engine(shell_engine), factory, max_steps, 1000);
+        const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        if (run == 0 || ms < best) { best = ms; }
+    }
+    return best;
+}
+} // namespace
+
+// ------- the event engine matches the stepwise engine turn by turn -------
+TEST(ShellEngines, EventMatchesStepwiseOnRandomBoards) {
+    std::mt19937 rng(31);
+    for (int game = 0; game < 24; ++game) {
+        const size_t width = 5 + rng() % 50, height = 5 + rng() % 50;
+        const vector<char> cells = randomMap(width, height, rng() % 20, 1 + rng() % 10, rng());
+        const TankAlgorithmFactory tanks = randomTanks(rng(), 1 + rng() % 12);
+        SCOPED_TRACE(testing::Message() << "game " << game << " (" << width << "x" << height << ")");
+        expectSameGame(play(width, height, cells, engine(ShellEngine::Event), tanks),
+                       play(width, height, cells, engine(ShellEngine::Stepwise), tanks));
+    }
+}
+
+// ------- crowded open boards: stacked shells, head-on collisions and shells across the wrapped edges -------
+TEST(ShellEngines, EventMatchesStepwiseOnCrowdedBoards) {
+    for (const uint32_t seed : {1u, 2u, 3u, 4u, 5u, 6u}) {
+        SCOPED_TRACE(seed);
+        const vector<char> cells = randomMap(24, 16, 0, 3, seed);
+        const TankAlgorithmFactory tanks = randomTanks(seed, 20);
+        const PlayedGame stepwise = play(24, 16, cells, engine(ShellEngine::Stepwise), tanks, 300, 200);
+        EXPECT_GT(stepwise.hashes.size(), 20u); // The game did play
+        expectSameGame(play(24, 16, cells, engine(ShellEngine::Event), tanks, 300, 200), stepwise);
+    }
+}
+
+// ------- large open boards: thousands of shells, head-on collisions that rewind the pass -------
+TEST(ShellEngines, EventMatchesStepwiseOnLargeOpenBoards) {
+    for (const uint32_t seed : {7u, 8u}) {
+        SCOPED_TRACE(seed);
+        const vector<char> cells = randomMap(200, 150, 0, 1, seed);
+        const TankAlgorithmFactory tanks = randomTanks(seed, 7);
+        expectSameGame(play(200, 150, cells, engine(ShellEngine::Event), tanks),
+                       play(200, 150, cells, engine(ShellEngine::Stepwise), tanks));
+    }
+}
+
+// ------- benchmark: run with --gtest_also_run_disabled_tests -------
+TEST(ShellEngines, DISABLED_Benchmark) {
+    struct Board { const char* name; size_t width, height; unsigned walls, tanks; };
+    for (const Board board : {Board{"open 500x400", 500, 400, 0, 1}, Board{"walled 200x200", 200, 200, 15, 2},
+                              Board{"crowded 60x40", 60, 40, 0, 12}}) {
+        const vector<char> cells = randomMap(board.width, board.height, board.walls, board.tanks, 29);
+        const TankAlgorithmFactory tanks = randomTanks(0, 7);
+        std::cout << board.name << ":";
+        for (const auto& [name, shell_engine] : {std::pair{"stepwise", ShellEngine::Stepwise}, std::pair{"event", ShellEngine::Event},
+                                                 std::pair{"banded", ShellEngine::Banded}}) {
+            std::cout << ' ' << name << ' ' << timedGame(board.width, board.height, cells, shell_engine, tanks, 200) << " ms";
+        }
+        std::cout << std::endl;
+    }
+}
@@ -0,0 +1,115 @@
+#include "./utils/gm_utils.test.cpp"
+
+namespace {
+// Two tanks per player among walls, weak walls and mines
+const size_t kWidth = 12, kHeight = 8, kTanks = 4, kMaxSteps = 200;
+const vector<char> kMap = mapOf({
+    "############",
+    "#1   @    2#",
+    "#   ##     #",
+    "#  $    @  #",
+    "#     $    #",
+    "#  @  ##   #",
+    "#1        2#",
+    "############",
+});
+
+// Actions of every tank for every turn, drawn up front from seeded random tanks
+vector<vector<ActionRequest>> randomActions(const uint32_t seed) {
+    const TankAlgorithmFactory factory = randomTanks(seed, 3);
+    vector<unique_ptr<TankAlgorithm>> tanks;
+    for (size_t tank = 0; tank < kTanks; ++tank) tanks.push_back(factory(1, static_cast<int>(tank)));
+
+    vector<vector<ActionRequest>> actions(kMaxSteps, vector<ActionRequest>(kTanks));
+    for (auto& turn : actions) {
+        for (size_t tank = 0; tank < kTanks; ++tank) turn[tank] = tanks[tank]->getAction();
+    }
+    return actions;
+}
+
+// Plays the given actions from turn @p from until the game ends, recording the state hash after every turn
+PlayedGame playActions(GM_209277367_322542887& gm, const vector<vector<ActionRequest>>& actions, const size_t from) {
+    PlayedGame game;
+    for (size_t turn = from; turn < actions.size() && gm.stepWithActions(actions[turn]); ++turn) {
+        game.hashes.push_back(gm.getStateHash());
+    }
+    game.result = gm.result();
+    return game;
+}
+
+bool initGame(GM_209277367_322542887& gm, const size_t width, const size_t height, const vector<char>& cells) {
+    static SilentPlayer player1, player2;
+    ExtSatelliteView map(width, height, cells);
+    return gm.init(width, height, map, "map", kMaxSteps, 30, player1, "p1", player2, "p2", randomTanks(0, 3), randomTanks(0, 3));
+}
+} // namespace
+
+// ------- stepWithActions is deterministic -------
+TEST(SnapshotRestore, SameActionsPlayTheSameGame) {
+    const auto actions = randomActions(11);
+    GM_209277367_322542887 first(false), second(false);
+    ASSERT_TRUE(initGame(first, kWidth, kHeight, kMap));
+    ASSERT_TRUE(initGame(second, kWidth, kHeight, kMap));
+
+    const PlayedGame played = playActions(first, actions, 0);
+    EXPECT_FALSE(played.hashes.empty());
+    expectSameGame(playActions(second, actions, 0), played);
+}
+
+// ------- snapshot at turn T, restore, replay the same actions -------
+TEST(SnapshotRestore, RestoreAndReplayEndsLikeTheOriginal) {
+    for (const uint32_t seed : {1u, 2u, 3u, 4u}) {
+        SCOPED_TRACE(seed);
+        const auto actions = randomActions(seed);
+        const size_t kSnapshotTurn = 6;
+
+        GM_209277367_322542887 gm(false);
+        ASSERT_TRUE(initGame(gm, kWidth, kHeight, kMap));
+        for (size_t turn = 0; turn < kSnapshotTurn; ++turn) { ASSERT_TRUE(gm.stepWithActions(actions[turn])); }
+
+        GameSnapshot snapshot;
+        gm.snapshot(snapshot);
+        const uint64_t snapshotHash = gm.getStateHash();
+        const PlayedGame original = playActions(gm, actions, kSnapshotTurn);
+
+        // On the same instance, after the game it was taken from has ended
+        gm.restore(snapshot);
+        EXPECT_EQ(gm.getTurn(), static_cast<int>(kSnapshotTurn));
+        EXPECT_EQ(gm.getStateHash(), snapshotHash);
+        expectSameGame(playActions(gm, actions, kSnapshotTurn), original);
+
+        // On an instance set up for another board, whose tables must be resized
+        GM_209277367_322542887 other(false);
+        ASSERT_TRUE(initGame(other, 30, 20, randomMap(30, 20, 10, 5, seed)));
+        other.restore(snapshot);
+        EXPECT_EQ(other.getStateHash(), snapshotHash);
+        expectSameGame(playActions(other, actions, kSnapshotTurn), original);
+    }
+}
+
+// ------- a snapshot of a finished game keeps its result -------
+TEST(SnapshotRestore, SnapshotOfAFinishedGameKeepsItsResult) {
+    const auto actions = randomActions(5);
+    GM_209277367_322542887 gm(false);
+    ASSERT_TRUE(initGame(gm, kWidth, kHeight, kMap));
+    for (size_t turn = 0; turn < actions.size() && gm.stepWithActions(actions[turn]); ++turn) {}
+    ASSERT_TRUE(gm.isGameOver());
+
+    GameSnapshot snapshot;
+    gm.snapshot(snapshot);
+    const GameResult original = gm.result();
+    ASSERT_NE(original.gameState, nullptr);
+
+    GM_209277367_322542887 other(false);
+    ASSERT_TRUE(initGame(other, 30, 20, randomMap(30, 20, 10, 5, 5)));
+    other.restore(snapshot);
+    EXPECT_FALSE(other.stepWithActions(actions.back())); // Nothing left to play
+    const GameResult restored = other.result();
+    expectSameResult(restored, original);
+    ASSERT_NE(restored.gameState, nullptr);
+    for (size_t y = 0; y < kHeight; ++y) {
+        for (size_t x = 0; x < kWidth; ++x) {
+            EXPECT_EQ(restored.gameState->getObjectAt(x, y), original.gameState->getObjectAt(x, y)) << x << "," << y;
+        }
+    }
+}
@@ -0,0 +1,111 @@
+#include "./utils/gm_utils.test.cpp"
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+namespace {
+const string kLogName = "output_map_GM_209277367_322542887_p1_p2"; // Verbose log of a game on "map" between "p1" and "p2"
+
+// How a game ended, as seen from outside the GameManager
+struct Ending {
+    GameResult result;
+    vector<char> board; // Final board read through result().gameState, empty if there is none
+    uint64_t hash = 0;
+    int turn = 0;
+    string log; // Verbose log, empty for quiet games
+};
+
+// Final board of a result, row-major
+vector<char> boardOf(const GameResult& result, const size_t width, const size_t height) {
+    vector<char> board;
+    if (!result.gameState) { return board; }
+    for (size_t y = 0; y < height; ++y) {
+        for (size_t x = 0; x < width; ++x) board.push_back(result.gameState->getObjectAt(x, y));
+    }
+    return board;
+}
+
+// Whole contents of the verbose log, which is then deleted
+string readLog() {
+    std::ifstream file(kLogName);
+    std::stringstream text;
+    text << file.rdbuf();
+    file.close();
+    std::remove(kLogName.c_str());
+    return text.str();
+}
+
+// Plays with run() when chunk is 0, else with init() and step(chunk) until the game ends
+Ending playInChunks(const size_t width, const size_t height, const vector<char>& cells, const TankAlgorithmFactory& factory,
+                    const size_t chunk, const bool verbose = false) {
+    ExtSatelliteView map(width, height, cells);
+    SilentPlayer player1, player2;
+    GM_209277367_322542887 gm(verbose);
+    Ending ending;
+    if (chunk == 0) {
+        ending.result = gm.run(width, height, map, "map", 150, 30, player1, "p1", player2, "p2", factory, factory);
+    } else {
+        bool running = gm.init(width, height, map, "map", 150, 30, player1, "p1", player2, "p2", factory, factory);
+        while (running) {
+            const int before = gm.getTurn();
+            running = gm.step(chunk);
+            if (running) { EXPECT_EQ(gm.getTurn(), before + static_cast<int>(chunk)); } // A running game plays the whole chunk
+        }
+        const int turn = gm.getTurn();
+        EXPECT_FALSE(gm.step(chunk)); // A finished game stays finished
+        EXPECT_EQ(gm.getTurn(), turn);
+        ending.result = gm.result();
+    }
+    ending.board = boardOf(ending.result, width, height);
+    ending.hash = gm.getStateHash();
+    ending.turn = gm.getTurn();
+    if (verbose) { ending.log = readLog(); }
+    return ending;
+}
+
+void expectSameEnding(const Ending& actual, const Ending& expected) {
+    expectSameResult(actual.result, expected.result);
+    EXPECT_EQ(actual.board, expected.board);
+    EXPECT_EQ(actual.hash, expected.hash);
+    EXPECT_EQ(actual.turn, expected.turn);
+    EXPECT_EQ(actual.log, expected.log);
+}
+} // namespace
+
+// ------- stepping one turn, a few turns or all at once ends the game as run() does -------
+TEST(StepApi, ChunksPlayAsRun) {
+    std::mt19937 rng(71);
+    int played = 0;
+    for (int game = 0; game < 10; ++game) {
+        const size_t width = 6 + rng() % 40, height = 6 + rng() % 40;
+        const vector<char> cells = randomMap(width, height, rng() % 15, 1 + rng() % 6, rng());
+        const TankAlgorithmFactory tanks = randomTanks(rng(), 1 + rng() % 8);
+        SCOPED_TRACE(testing::Message() << "game " << game << " (" << width << "x" << height << ")");
+        const Ending run = playInChunks(width, height, cells, tanks, 0);
+        played += run.turn > 0;
+        for (const size_t chunk : {size_t{1}, size_t{7}, size_t{64}, std::numeric_limits<size_t>::max()}) {
+            SCOPED_TRACE(testing::Message() << "step(" << chunk << ")");
+            expectSameEnding(playInChunks(width, height, cells, tanks, chunk), run);
+        }
+    }
+    EXPECT_GT(played, 5); // Most boards give both players a tank
+}
+
+// ------- a verbose game stepped in chunks writes the same log as run() -------
+TEST(StepApi, ChunksWriteTheRunLog) {
+    std::remove(kLogName.c_str());
+    std::mt19937 rng(73);
+    for (int game = 0; game < 4; ++game) {
+        const size_t width = 8 + rng() % 30, height = 8 + rng() % 30;
+        const vector<char> cells = randomMap(width, height, 10, 3, rng());
+        const TankAlgorithmFactory tanks = randomTanks(rng(), 4);
+        SCOPED_TRACE(testing::Message() << "game " << game << " (" << width << "x" << height << ")");
+        const Ending run = playInChunks(width, height, cells, tanks, 0, true);
+        EXPECT_FALSE(run.log.empty());
+        for (const size_t chunk : {size_t{1}, size_t{5}}) {
+            SCOPED_TRACE(testing::Message() << "step(" << chunk << ")");
+            expectSameEnding(playInChunks(width, height, cells, tanks, chunk, true), run);
+        }
+    }
+}
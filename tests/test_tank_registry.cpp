@@ -0,0 +1,44 @@
+#include "./utils/gm_utils.test.cpp"
+
+namespace {
+// Plays scripted turns (one action per tank), then DoNothing until the game ends
+GameResult playScripted(const size_t width, const size_t height, const vector<char>& cells,
+                        const vector<vector<ActionRequest>>& turns, const size_t max_steps = 40) {
+    ExtSatelliteView map(width, height, cells);
+    SilentPlayer player1, player2;
+    GM_209277367_322542887 gm(false);
+    if (!gm.init(width, height, map, "map", max_steps, 30, player1, "p1", player2, "p2", randomTanks(0, 0), randomTanks(0, 0))) {
+        return gm.result();
+    }
+    const vector<ActionRequest> idle(turns.empty() ? 0 : turns.front().size(), ActionRequest::DoNothing);
+    for (size_t turn = 0; gm.stepWithActions(turn < turns.size() ? turns[turn] : idle); ++turn) {}
+    return gm.result();
+}
+} // namespace
+
+// ------- a tank standing where another tank died is hit like any other -------
+TEST(TankRegistry, HitOnTheCellOfADeadTankDestroysTheLiveTank) {
+    using enum ActionRequest;
+    // Tank 0 (player 1) is shot by tank 1 (player 1), tank 1 drives onto its cell, and tank 2 (player 2) shoots it there
+    const vector<char> cells = mapOf({
+        "#########",
+        "#1 1   2#",
+        "#########",
+    });
+    const vector<vector<ActionRequest>> turns = {
+        {DoNothing, Shoot, DoNothing},
+        {DoNothing, DoNothing, RotateLeft90},
+        {DoNothing, DoNothing, RotateLeft90},
+        {DoNothing, MoveForward, DoNothing},
+        {DoNothing, MoveForward, DoNothing},
+        {DoNothing, DoNothing, Shoot},
+    };
+
+    const GameResult result = playScripted(9, 3, cells, turns);
+    EXPECT_EQ(result.winner, 2);
+    EXPECT_EQ(result.reason, GameResult::ALL_TANKS_DEAD);
+    ASSERT_EQ(result.remaining_tanks.size(), 2u);
+    EXPECT_EQ(result.remaining_tanks[0], 0u);
+    EXPECT_EQ(result.remaining_tanks[1], 1u);
+    EXPECT_LT(result.rounds, 20u);
+}
@@ -0,0 +1,58 @@
+#include "TiledBoard.h"
+#include "ExtSatelliteView.h"
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace UserCommon_209277367_322542887;
+
+// ------- fill-only tiles are shared until written -------
+TEST(TiledBoard, WritesCopyOnlyTheTouchedTile) {
+    TiledBoard board(200, 130); // 4 x 3 tiles, the last ones partial
+    EXPECT_EQ(board.getTileCount(), 12u);
+    EXPECT_EQ(board.getOwnedTileCount(), 0u);
+
+    board.set(199, 129, '#');
+    board.set(5, 5, ' '); // Same value: nothing copied
+    EXPECT_EQ(board.getOwnedTileCount(), 1u);
+    EXPECT_EQ(board.get(199, 129), '#');
+    EXPECT_EQ(board.get(198, 129), ' ');
+    EXPECT_EQ(board.get(0, 0), ' ');
+
+    TiledBoard copy = board; // Shares every tile
+    copy.set(199, 129, '@');
+    EXPECT_EQ(board.get(199, 129), '#');
+    EXPECT_EQ(copy.get(199, 129), '@');
+}
+
+// ------- rows round-trip across tile borders -------
+TEST(TiledBoard, RowsRoundTripAcrossTiles) {
+    const size_t width = 150;
+    TiledBoard board(width, 70);
+    std::string row(width, ' ');
+    for (size_t x = 0; x < width; x += 7) row[x] = (x % 2) ? '#' : '1';
+    board.assignRow(66, row.data());
+
+    std::string out(width, '?');
+    board.copyRow(66, out.data());
+    EXPECT_EQ(out, row);
+    board.copyRow(65, out.data());
+    EXPECT_EQ(out, std::string(width, ' '));
+    EXPECT_EQ(board.getOwnedTileCount(), 3u); // Only the tile row holding y = 66
+}
+
+// ------- a tiled view reads like a dense one -------
+TEST(TiledBoard, TiledSatelliteViewMatchesDenseView) {
+    const size_t width = 70, height = 3;
+    std::vector<char> cells(width * height, ' ');
+    cells[1 * width + 68] = '2';
+    cells[2 * width + 3] = '@';
+
+    TiledBoard board(width, height);
+    for (size_t y = 0; y < height; ++y) board.assignRow(y, cells.data() + y * width);
+
+    const ExtSatelliteView dense(width, height, cells);
+    const ExtSatelliteView tiled(std::move(board));
+    for (size_t y = 0; y <= height; ++y)
+        for (size_t x = 0; x <= width; ++x)
+            EXPECT_EQ(tiled.getObjectAt(x, y), dense.getObjectAt(x, y));
+}
@@ -0,0 +1,90 @@
+#include "./utils/gm_utils.test.cpp"
+#include <chrono>
+#include <thread>
+
+namespace {
+// Takes its time over every action, then plays it
+class SlowTank : public TankAlgorithm {
+public:
+    SlowTank(ActionRequest action, std::chrono::milliseconds delay) : action_(action), delay_(delay) {}
+    ActionRequest getAction() override {
+        std::this_thread::sleep_for(delay_);
+        return action_;
+    }
+    void updateBattleInfo(BattleInfo&) override {}
+private:
+    ActionRequest action_;
+    std::chrono::milliseconds delay_;
+};
+
+TankAlgorithmFactory tanksPlaying(const ActionRequest action, const std::chrono::milliseconds delay = {}) {
+    return [action, delay](int, int) { return std::make_unique<SlowTank>(action, delay); };
+}
+
+// Player 1's tank faces player 2's across an open row
+const size_t kWidth = 8, kHeight = 3, kMaxSteps = 6;
+const vector<char> kMap = mapOf({
+    "########",
+    "#2    1#",
+    "########",
+});
+
+struct BudgetedGame {
+    PlayedGame game;
+    BudgetReport report;
+};
+
+BudgetedGame playBudgeted(const GameManagerOptions& options, const TankAlgorithmFactory& player1, const TankAlgorithmFactory& player2) {
+    ExtSatelliteView map(kWidth, kHeight, kMap);
+    SilentPlayer silent1, silent2;
+    GM_209277367_322542887 gm(false);
+    gm.setOptions(options);
+
+    BudgetedGame played;
+    if (gm.init(kWidth, kHeight, map, "map", kMaxSteps, 30, silent1, "p1", silent2, "p2", player1, player2)) {
+        while (gm.step(1)) { played.game.hashes.push_back(gm.getStateHash()); }
+    }
+    played.game.result = gm.result();
+    played.report = gm.getBudgetReport();
+    return played;
+}
+
+GameManagerOptions budgets(const size_t action_ms, const size_t game_ms) {
+    GameManagerOptions options;
+    options.actionBudgetMs = action_ms;
+    options.gameBudgetMs = game_ms;
+    return options;
+}
+} // namespace
+
+// ------- an action over the per-call budget is played as DoNothing -------
+TEST(TimeBudget, SlowActionIsPlayedAsDoNothing) {
+    using std::chrono::milliseconds;
+    // Player 1's tank would shoot player 2's on the first turn, but answers too late every time
+    const BudgetedGame slow = playBudgeted(budgets(5, 0), tanksPlaying(ActionRequest::Shoot, milliseconds(40)),
+                                           tanksPlaying(ActionRequest::RotateLeft45));
+    const BudgetedGame idle = playBudgeted(budgets(0, 0), tanksPlaying(ActionRequest::DoNothing),
+                                           tanksPlaying(ActionRequest::RotateLeft45));
+
+    expectSameGame(slow.game, idle.game);
+    EXPECT_EQ(slow.game.hashes.size(), kMaxSteps);
+    EXPECT_EQ(slow.report.overruns[0], kMaxSteps);
+    EXPECT_EQ(slow.report.overruns[1], 0u);
+    EXPECT_FALSE(slow.report.forfeited[0] || slow.report.forfeited[1]);
+}
+
+// ------- a player over its per-game budget forfeits -------
+TEST(TimeBudget, PlayerOverGameBudgetForfeits) {
+    using std::chrono::milliseconds;
+    const BudgetedGame slow = playBudgeted(budgets(0, 50), tanksPlaying(ActionRequest::DoNothing, milliseconds(30)),
+                                           tanksPlaying(ActionRequest::DoNothing));
+
+    EXPECT_TRUE(slow.report.forfeited[0]);
+    EXPECT_FALSE(slow.report.forfeited[1]);
+    EXPECT_EQ(slow.report.overruns[0], 0u); // No per-call budget
+    EXPECT_EQ(slow.game.result.winner, 2);
+    EXPECT_LT(slow.game.result.rounds, kMaxSteps); // Ended by the forfeit, not the step limit
+    ASSERT_EQ(slow.game.result.remaining_tanks.size(), 2u);
+    EXPECT_EQ(slow.game.result.remaining_tanks[0], 0u);
+    EXPECT_EQ(slow.game.result.remaining_tanks[1], 1u);
+}
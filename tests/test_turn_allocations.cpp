@@ -0,0 +1,112 @@
+#include "./utils/gm_utils.test.cpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <thread>
+
+// ------- counting operator new -------
+namespace {
+thread_local bool counting = false; // Only the game thread, and only inside step()
+std::atomic<size_t> allocations{0};
+
+void* countedAlloc(size_t bytes, size_t alignment) {
+    if (counting) { allocations.fetch_add(1, std::memory_order_relaxed); }
+    if (bytes == 0) { bytes = 1; }
+    void* p = alignment <= alignof(std::max_align_t) ? std::malloc(bytes)
+        : std::aligned_alloc(alignment, (bytes + alignment - 1) / alignment * alignment);
+    if (!p) { throw std::bad_alloc(); }
+    return p;
+}
+} // namespace
+
+void* operator new(size_t bytes) { return countedAlloc(bytes, alignof(std::max_align_t)); }
+void* operator new(size_t bytes, std::align_val_t alignment) { return countedAlloc(bytes, static_cast<size_t>(alignment)); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+
+namespace {
+struct TurnCount {
+    size_t turns = 0; // Turns played that did not end the game
+    size_t allocating = 0; // Of those, turns that allocated
+};
+
+// Plays a game on a fresh thread (so its arena starts empty), counting allocations per turn.
+// The turn that ends the game builds the GameResult and is not counted.
+TurnCount playCounted(const size_t width, const size_t height, vector<char> cells, const uint32_t seed,
+                      const ShellEngine engine) {
+    TurnCount count;
+    std::thread game([&] {
+        ExtSatelliteView map(width, height, std::move(cells));
+        SilentPlayer player1, player2;
+        const TankAlgorithmFactory factory = randomTanks(seed, 2);
+
+        GM_209277367_322542887 gm(false);
+        GameManagerOptions options;
+        options.shellEngine = engine;
+        gm.setOptions(options);
+        if (!gm.init(width, height, map, "map", 400, 40, player1, "p1", player2, "p2", factory, factory)) { return; }
+
+        for (bool running = true; running;) {
+            allocations = 0;
+            counting = true;
+            running = gm.step(1);
+            counting = false;
+            if (!running) { break; }
+            ++count.turns;
+            if (allocations != 0) { ++count.allocating; }
+        }
+        (void)gm.result();
+    });
+    game.join();
+    return count;
+}
+} // namespace
+
+// ------- the hook sees allocations -------
+TEST(TurnAllocations, HookCountsAllocations) {
+    allocations = 0;
+    counting = true;
+    auto boxed = std::make_unique<int>(7);
+    counting = false;
+    EXPECT_EQ(*boxed, 7);
+    EXPECT_EQ(allocations, 1u);
+}
+
+// ------- steady-state turns do not allocate -------
+TEST(TurnAllocations, StepwiseTurnsDoNotAllocate) {
+    std::mt19937 rng(11);
+    size_t turns = 0;
+    for (int game = 0; game < 12; ++game) {
+        const size_t width = 6 + rng() % 40, height = 6 + rng() % 40;
+        const TurnCount count = playCounted(width, height, randomMap(width, height, 15, 5, rng()), rng(), ShellEngine::Stepwise);
+        EXPECT_EQ(count.allocating, 0u) << "game " << game << " (" << width << "x" << height << ")";
+        turns += count.turns;
+    }
+    EXPECT_GT(turns, 100u); // The games did play
+}
+
+TEST(TurnAllocations, EventEngineTurnsDoNotAllocate) {
+    std::mt19937 rng(23);
+    for (int game = 0; game < 12; ++game) {
+        const size_t width = 6 + rng() % 40, height = 6 + rng() % 40;
+        const TurnCount count = playCounted(width, height, randomMap(width, height, 15, 5, rng()), rng(), ShellEngine::Event);
+        EXPECT_EQ(count.allocating, 0u) << "game " << game << " (" << width << "x" << height << ")";
+    }
+}
+
+// ------- many tanks, lots of shells in flight -------
+TEST(TurnAllocations, CrowdedBoardDoesNotAllocate) {
+    const size_t width = 90, height = 70;
+    std::mt19937 rng(5);
+    vector<char> cells(width * height, ' ');
+    for (char& cell : cells) {
+        const unsigned r = rng() % 10;
+        cell = r == 0 ? '#' : r == 1 ? '1' : r == 2 ? '2' : ' ';
+    }
+
+    const TurnCount count = playCounted(width, height, std::move(cells), 77, ShellEngine::Stepwise);
+    EXPECT_GT(count.turns, 0u);
+    EXPECT_EQ(count.allocating, 0u);
+}
@@ -0,0 +1,62 @@
+#include "ExtBattleInfo.h"
+#include "ExtSatelliteView.h"
+#include "Shell.h"
+#include <gtest/gtest.h>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace UserCommon_209277367_322542887;
+
+static_assert(std::is_nothrow_move_constructible_v<Shell> && std::is_nothrow_copy_assignable_v<Shell>);
+static_assert(std::is_nothrow_move_constructible_v<ExtSatelliteView> && std::is_nothrow_move_assignable_v<ExtSatelliteView>);
+static_assert(std::is_nothrow_move_constructible_v<ExtBattleInfo> && std::is_nothrow_move_assignable_v<ExtBattleInfo>);
+
+// ------- shells are plain values -------
+TEST(ValueTypes, ShellsLiveContiguously) {
+    std::vector<Shell> shells;
+    shells.emplace_back(1, 2, Direction::R);
+    shells.emplace_back(std::pair{3, 4}, Direction::DL);
+    shells.front().setAboveMine(true);
+    shells.reserve(64); // Relocates by move
+
+    EXPECT_EQ(shells[0].getLocation(), (std::pair{1, 2}));
+    EXPECT_TRUE(shells[0].isAboveMine());
+    EXPECT_EQ(shells[1].getDirection(), Direction::DL);
+}
+
+// ------- views move their cells and share them on copy -------
+TEST(ValueTypes, MovedViewTakesTheCellsAndLeavesAnEmptyView) {
+    std::vector<char> cells = {'#', ' ', '1', '@', '2', ' '};
+    const char* buffer = cells.data();
+    ExtSatelliteView view(3, 2, std::move(cells));
+
+    ExtSatelliteView moved(std::move(view));
+    EXPECT_EQ(moved.getRawBuffer(), buffer);
+    EXPECT_EQ(moved.getObjectAt(2, 0), '1');
+    EXPECT_EQ(view.getWidth(), 0u); // Moved-from
+    EXPECT_EQ(view.getObjectAt(0, 0), '&');
+
+    view = std::move(moved);
+    EXPECT_EQ(view.getObjectAt(0, 1), '@');
+    EXPECT_EQ(moved.getHeight(), 0u); // Moved-from
+
+    const ExtSatelliteView copy = view;
+    EXPECT_EQ(copy.getRawBuffer(), buffer);
+}
+
+// ------- battle info hands its board over without copying -------
+TEST(ValueTypes, BattleInfoBoardIsTakenByMove) {
+    std::vector<std::vector<char>> board = {{' ', '*'}, {'%', '#'}};
+    const char* row = board[1].data();
+    ExtBattleInfo info(std::move(board), {{1, 0}}, 5, {0, 1});
+
+    EXPECT_EQ(info.getGameboard()[1].data(), row);
+    ExtBattleInfo moved(std::move(info));
+    const auto taken = moved.takeGameboard();
+    EXPECT_EQ(taken[1].data(), row);
+    EXPECT_TRUE(moved.getGameboard().empty());
+    EXPECT_EQ(moved.takeShellsLocation(), (std::vector<std::pair<int, int>>{{1, 0}}));
+    EXPECT_EQ(moved.getInitialAmmo(), 5);
+    EXPECT_EQ(moved.getInitialLoc(), (std::pair{0, 1}));
+}
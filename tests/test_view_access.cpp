@@ -0,0 +1,79 @@
+#include "ViewAccess.h"
+#include "ExtSatelliteView.h"
+#include "SharedSatelliteView.h"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace UserCommon_209277367_322542887;
+
+namespace {
+
+// ------- a SatelliteView of unknown type (slow path) -------
+class ForeignView : public SatelliteView {
+public:
+    ForeignView(size_t width, std::string cells) : width_(width), cells_(std::move(cells)) {}
+    char getObjectAt(size_t x, size_t y) const override {
+        const size_t height = cells_.size() / width_;
+        return (x < width_ && y < height) ? cells_[y * width_ + x] : '&';
+    }
+private:
+    size_t width_;
+    std::string cells_;
+};
+
+std::string readAll(const SatelliteView& view, size_t width, size_t height) {
+    std::string out(width * height, '?');
+    copyView(view, width, height, out.data());
+    return out;
+}
+
+std::string readRows(const SatelliteView& view, size_t width, size_t height) {
+    std::string out(width * height, '?');
+    for (size_t y = 0; y < height; ++y) copyViewRow(view, y, width, out.data() + y * width);
+    return out;
+}
+
+} // namespace
+
+// ------- every view type reads the same cells as getObjectAt -------
+TEST(ViewAccess, BulkReadsMatchGetObjectAt) {
+    const std::string cells = "#  *1 "
+                              " @ 2 *"
+                              "$  *  ";
+    const size_t width = 6, height = 3;
+
+    const ExtSatelliteView dense(width, height, std::vector<char>(cells.begin(), cells.end()));
+    TiledBoard tiles(width, height);
+    for (size_t y = 0; y < height; ++y) tiles.assignRow(y, cells.data() + y * width);
+    const ExtSatelliteView tiled(std::move(tiles));
+    const std::vector<char> shared_cells(cells.begin(), cells.end());
+    const SharedSatelliteView shared(width, height, shared_cells.data(), 4, 0); // '%' over the '1'
+    const ForeignView foreign(width, cells);
+
+    std::string with_self = cells;
+    with_self[4] = '%';
+
+    EXPECT_EQ(readAll(dense, width, height), cells);
+    EXPECT_EQ(readAll(tiled, width, height), cells);
+    EXPECT_EQ(readAll(shared, width, height), with_self);
+    EXPECT_EQ(readAll(foreign, width, height), cells);
+    EXPECT_EQ(readRows(dense, width, height), cells);
+    EXPECT_EQ(readRows(tiled, width, height), cells);
+    EXPECT_EQ(readRows(shared, width, height), with_self);
+    EXPECT_EQ(readRows(foreign, width, height), cells);
+
+    // A request larger than the view falls back to getObjectAt and its '&'
+    std::string wide(width + 1, '?');
+    copyViewRow(dense, 0, width + 1, wide.data());
+    EXPECT_EQ(wide, "#  *1 &");
+}
+
+// ------- row scans find every target in order -------
+TEST(ViewAccess, FindInRowReturnsEveryMatchInOrder) {
+    const std::string row = "* ** %*";
+    std::vector<std::pair<int, int>> found;
+    findInRow(row.data(), row.size(), 3, '*', found);
+    const std::vector<std::pair<int, int>> expected = {{0, 3}, {2, 3}, {3, 3}, {6, 3}};
+    EXPECT_EQ(found, expected);
+}
@@ -0,0 +1,107 @@
+// tests/utils/gm_utils.test.cpp: shared fixture of the tests built with the GameManager sources
+#include "GM_209277367_322542887.h"
+#include "GameManagerRegistration.h"
+#include <gtest/gtest.h>
+#include <random>
+
+// These targets link the GameManager sources directly; registration is the Simulator's job
+GameManagerRegistration::GameManagerRegistration(GameManagerFactory) {}
+
+using GameManager_209277367_322542887::GM_209277367_322542887;
+using namespace UserCommon_209277367_322542887;
+
+namespace {
+// Moves, rotates and shoots at random, never asking for battle info. Shoot is drawn @p shots
+// times as often as each other action, so 7 shots make every other action a shot on average.
+class RandomTank : public TankAlgorithm {
+public:
+    RandomTank(uint32_t seed, unsigned shots) : state_(seed), shots_(shots) {}
+    ActionRequest getAction() override {
+        static constexpr ActionRequest kOthers[] = {
+            ActionRequest::MoveForward, ActionRequest::MoveBackward, ActionRequest::RotateLeft90, ActionRequest::RotateRight90,
+            ActionRequest::RotateLeft45, ActionRequest::RotateRight45, ActionRequest::DoNothing
+        };
+        state_ = state_ * 1103515245u + 12345u;
+        const unsigned r = (state_ >> 16) % (std::size(kOthers) + shots_);
+        return r < std::size(kOthers) ? kOthers[r] : ActionRequest::Shoot;
+    }
+    void updateBattleInfo(BattleInfo&) override {}
+private:
+    uint32_t state_;
+    unsigned shots_;
+};
+
+// Random tanks of both players, seeded by the tank's player and index
+TankAlgorithmFactory randomTanks(const uint32_t seed, const unsigned shots) {
+    return [seed, shots](int player, int tank) {
+        return std::make_unique<RandomTank>(seed + static_cast<uint32_t>(player * 7919 + tank), shots);
+    };
+}
+
+class SilentPlayer : public Player {
+public:
+    void updateTankWithBattleInfo(TankAlgorithm&, SatelliteView&) override {}
+};
+
+// Random map: wall_percent walls, 1% mines and tank_percent tanks of each player
+vector<char> randomMap(const size_t width, const size_t height, const unsigned wall_percent, const unsigned tank_percent,
+                       const uint32_t seed) {
+    std::mt19937 rng(seed);
+    vector<char> cells(width * height, ' ');
+    const unsigned mines = wall_percent + 1, tanks1 = mines + tank_percent, tanks2 = tanks1 + tank_percent;
+    for (char& cell : cells) {
+        const unsigned r = rng() % 100;
+        cell = r < wall_percent ? '#' : r < mines ? '@' : r < tanks1 ? '1' : r < tanks2 ? '2' : ' ';
+    }
+    return cells;
+}
+
+// Map from rows of cell symbols
+vector<char> mapOf(std::initializer_list<std::string_view> rows) {
+    vector<char> cells;
+    for (const std::string_view row : rows) cells.insert(cells.end(), row.begin(), row.end());
+    return cells;
+}
+
+struct PlayedGame {
+    vector<uint64_t> hashes; // State hash after every turn
+    GameResult result;
+};
+
+// Plays a whole game one turn at a time on gm, recording the state hash after every turn
+PlayedGame playOn(GM_209277367_322542887& gm, const size_t width, const size_t height, const vector<char>& cells,
+                  const TankAlgorithmFactory& factory, const size_t max_steps = 150, const size_t num_shells = 30) {
+    ExtSatelliteView map(width, height, cells);
+    SilentPlayer player1, player2;
+
+    PlayedGame game;
+    if (gm.init(width, height, map, "map", max_steps, num_shells, player1, "p1", player2, "p2", factory, factory)) {
+        while (gm.step(1)) { game.hashes.push_back(gm.getStateHash()); }
+    }
+    game.result = gm.result();
+    return game;
+}
+
+// Same, on a fresh GameManager with the given options
+PlayedGame play(const size_t width, const size_t height, const vector<char>& cells, const GameManagerOptions& options,
+                const TankAlgorithmFactory& factory, const size_t max_steps = 150, const size_t num_shells = 30) {
+    GM_209277367_322542887 gm(false);
+    gm.setOptions(options);
+    return playOn(gm, width, height, cells, factory, max_steps, num_shells);
+}
+
+void expectSameResult(const GameResult& actual, const GameResult& expected) {
+    EXPECT_EQ(actual.winner, expected.winner);
+    EXPECT_EQ(actual.reason, expected.reason);
+    EXPECT_EQ(actual.remaining_tanks, expected.remaining_tanks);
+    EXPECT_EQ(actual.rounds, expected.rounds);
+}
+
+void expectSameGame(const PlayedGame& actual, const PlayedGame& expected) {
+    ASSERT_EQ(actual.hashes.size(), expected.hashes.size());
+    for (size_t turn = 0; turn < expected.hashes.size(); ++turn) {
+        ASSERT_EQ(actual.hashes[turn], expected.hashes[turn]) << "turn " << turn;
+    }
+    expectSameResult(actual.result, expected.result);
+}
+} // namespace